@@ -0,0 +1,141 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Non-owning, read-only view over a contiguous sequence of bytes.
+ *
+ * <p>Copying a view doesn't copy the bytes. The view is only valid as long as the storage it
+ * refers to, which is owned by the provider of the view.
+ *
+ * @since 1.2.0
+ */
+class ByteView final {
+public:
+    /**
+     * Creates an empty view.
+     *
+     * @since 1.2.0
+     */
+    ByteView() : mData(nullptr), mSize(0) {}
+
+    /**
+     * @param data The address of the first byte (may be null if <b>size</b> is 0).
+     * @param size The number of bytes.
+     * @since 1.2.0
+     */
+    ByteView(const uint8_t* data, const size_t size) : mData(data), mSize(size) {}
+
+    /**
+     * @param bytes The bytes to refer to.
+     * @since 1.2.0
+     */
+    explicit ByteView(const std::vector<uint8_t>& bytes)
+    : mData(bytes.data()), mSize(bytes.size()) {}
+
+    /**
+     * Prevents creating a view on a temporary vector, which would dangle immediately.
+     *
+     * @since 1.2.0
+     */
+    ByteView(const std::vector<uint8_t>&&) = delete;
+
+    /**
+     * @return The address of the first byte, possibly null if the view is empty.
+     * @since 1.2.0
+     */
+    const uint8_t* data() const
+    {
+        return mData;
+    }
+
+    /**
+     * @return The number of bytes.
+     * @since 1.2.0
+     */
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @return <b>true</b> if the view contains no byte.
+     * @since 1.2.0
+     */
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @param index The index of the byte (should be lower than size()).
+     * @return The byte at the provided index.
+     * @since 1.2.0
+     */
+    uint8_t operator[](const size_t index) const
+    {
+        return mData[index];
+    }
+
+    /**
+     * @return An iterator on the first byte.
+     * @since 1.2.0
+     */
+    const uint8_t* begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @return The past-the-end iterator.
+     * @since 1.2.0
+     */
+    const uint8_t* end() const
+    {
+        return mData + mSize;
+    }
+
+    /**
+     * Copies the bytes into a new vector.
+     *
+     * @return A not null but possibly empty vector.
+     * @since 1.2.0
+     */
+    std::vector<uint8_t> toVector() const
+    {
+        return std::vector<uint8_t>(begin(), end());
+    }
+
+private:
+    /**
+     *
+     */
+    const uint8_t* mData;
+
+    /**
+     *
+     */
+    size_t mSize;
+};
+
+}
+}
+}
@@ -0,0 +1,80 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Token allowing to request the cancellation of an asynchronous operation.
+ *
+ * <p>The token is shared between the requester of the cancellation and the operation, which
+ * checks it at its cancellation points. It can be used from any thread.
+ *
+ * @since 1.2.0
+ */
+class CancellationToken final {
+public:
+    /**
+     * Creates a token not yet cancelled.
+     *
+     * @since 1.2.0
+     */
+    CancellationToken() : mCancelled(false) {}
+
+    /**
+     * Requests the cancellation of the operations using this token.
+     *
+     * <p>This method has no effect if the cancellation has already been requested.
+     *
+     * @since 1.2.0
+     */
+    void cancel() noexcept
+    {
+        mCancelled.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Indicates whether the cancellation has been requested.
+     *
+     * @return <b>true</b> if cancel() has been invoked.
+     * @since 1.2.0
+     */
+    bool isCancelled() const noexcept
+    {
+        return mCancelled.load(std::memory_order_acquire);
+    }
+
+    /**
+     *
+     */
+    CancellationToken(const CancellationToken&) = delete;
+
+    /**
+     *
+     */
+    CancellationToken& operator=(const CancellationToken&) = delete;
+
+private:
+    /**
+     *
+     */
+    std::atomic<bool> mCancelled;
+};
+
+}
+}
+}
@@ -0,0 +1,99 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Reader */
+#include "ObservableCardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Scoped guard invoking ObservableCardReader::finalizeCardProcessing() when leaving the scope of
+ * a card processing, whether normally or by an exception.
+ *
+ * <p>Typical use, in an observer:
+ *
+ * <pre>
+ * CardProcessingGuard guard(reader);
+ * // card processing, possibly throwing
+ * </pre>
+ *
+ * @since 1.2.0
+ */
+class CardProcessingGuard final {
+public:
+    /**
+     * @param reader The reader whose card processing is to be finalized (should be not null).
+     * @since 1.2.0
+     */
+    explicit CardProcessingGuard(std::shared_ptr<ObservableCardReader> reader)
+    : mReader(reader) {}
+
+    /**
+     * Finalizes the card processing if not already done.
+     *
+     * <p>Any exception thrown by the finalization is ignored since it cannot be propagated from
+     * a destructor.
+     *
+     * @since 1.2.0
+     */
+    ~CardProcessingGuard()
+    {
+        try {
+            finalize();
+        } catch (...) {
+            /* Nothing to do */
+        }
+    }
+
+    /**
+     * Finalizes the card processing immediately, allowing the exceptions to be handled by the
+     * caller. The guard then has no further effect.
+     *
+     * <p>This method has no effect if the processing has already been finalized by this guard.
+     *
+     * @since 1.2.0
+     */
+    void finalize()
+    {
+        if (mReader != nullptr) {
+            const std::shared_ptr<ObservableCardReader> reader = mReader;
+            mReader = nullptr;
+            reader->finalizeCardProcessing();
+        }
+    }
+
+    /**
+     *
+     */
+    CardProcessingGuard(const CardProcessingGuard&) = delete;
+
+    /**
+     *
+     */
+    CardProcessingGuard& operator=(const CardProcessingGuard&) = delete;
+
+private:
+    /**
+     *
+     */
+    std::shared_ptr<ObservableCardReader> mReader;
+};
+
+}
+}
+}
@@ -14,6 +14,9 @@
 
 #include <string>
 
+/* Calypsonet Terminal Reader */
+#include "ReaderResult.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace reader {
@@ -52,11 +55,27 @@ public:
     /**
      * Checks if the card is present.
      *
+     * <p>Implementations are expected to be thin wrappers of tryIsCardPresent() (see
+     * getValueOrThrow).
+     *
      * @return <b>true</b> if a card is inserted in the reader else <b>false</b>.
      * @throw ReaderCommunicationException If the communication with the reader has failed.
      * @since 1.0.0
      */
     virtual bool isCardPresent() = 0;
+
+    /**
+     * Checks if the card is present, without throwing exceptions.
+     *
+     * <p>Exception-free variant of isCardPresent() intended for hot paths, where a failure is
+     * an ordinary runtime condition (e.g. a card removed during the exchange).
+     *
+     * @return A result holding <b>true</b> if a card is inserted in the reader, or the error code
+     *         ReaderErrorCode::READER_COMMUNICATION_FAILURE if the communication with the reader
+     *         has failed.
+     * @since 1.2.0
+     */
+    virtual ReaderResult<bool> tryIsCardPresent() noexcept = 0;
 };
 
 }
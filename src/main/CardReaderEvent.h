@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <typeinfo>
 
@@ -67,9 +68,60 @@ public:
          *
          * @since 1.0.0
          */
-        UNAVAILABLE
+        UNAVAILABLE,
+
+        /**
+         * The reader has become available again after an automatic restart of the observation
+         * process (see ObservableCardReader::setObservationRestartPolicy).
+         *
+         * @since 1.2.0
+         */
+        AVAILABLE
     };
 
+    /**
+     * Bit mask of event types, each type being represented by the bit returned by
+     * maskOf(const Type).
+     *
+     * @since 1.2.0
+     */
+    typedef unsigned int TypeMask;
+
+    /**
+     * Returns the bit mask representing the provided event type.
+     *
+     * <p>Masks can be combined with the bitwise OR operator, e.g.
+     * <code>maskOf(CARD_INSERTED) | maskOf(CARD_MATCHED)</code>.
+     *
+     * @param type The event type.
+     * @return A non-zero mask with a single bit set.
+     * @since 1.2.0
+     */
+    static constexpr TypeMask maskOf(const Type type)
+    {
+        return 1u << static_cast<unsigned int>(type);
+    }
+
+    /**
+     * Returns the bit mask representing all event types.
+     *
+     * @return A non-zero mask.
+     * @since 1.2.0
+     */
+    static constexpr TypeMask maskOfAll()
+    {
+        return maskOf(CARD_INSERTED) |
+               maskOf(CARD_MATCHED) |
+               maskOf(CARD_REMOVED) |
+               maskOf(UNAVAILABLE) |
+               maskOf(AVAILABLE);
+    }
+
+    /**
+     *
+     */
+    virtual ~CardReaderEvent() = default;
+
     /**
      * Returns the name of the reader that generated the event.
      *
@@ -101,6 +153,46 @@ public:
      */
     virtual const std::shared_ptr<ScheduledCardSelectionsResponse>
         getScheduledCardSelectionsResponse() const = 0;
+
+    /**
+     * Returns the monotonic time at which the card was detected by the reader.
+     *
+     * <p>The timestamps are only collected when enabled with
+     * ObservableCardReader::setEventTimestampsEnabled(const bool). Otherwise, all timestamp
+     * getters return a default-constructed time point (zero time since epoch).
+     *
+     * @return A time point, default-constructed if not collected or not relevant for the event
+     *         type.
+     * @since 1.2.0
+     */
+    virtual std::chrono::steady_clock::time_point getCardDetectionTime() const = 0;
+
+    /**
+     * Returns the monotonic time at which the execution of the card selection scenario started.
+     *
+     * @return A time point, default-constructed if not collected or if no scenario was executed.
+     * @since 1.2.0
+     */
+    virtual std::chrono::steady_clock::time_point getSelectionStartTime() const = 0;
+
+    /**
+     * Returns the monotonic time at which the execution of the card selection scenario ended.
+     *
+     * @return A time point, default-constructed if not collected or if no scenario was executed.
+     * @since 1.2.0
+     */
+    virtual std::chrono::steady_clock::time_point getSelectionEndTime() const = 0;
+
+    /**
+     * Returns the monotonic time at which the event was dispatched to the observers, i.e. left
+     * the event queue.
+     *
+     * <p>The difference with the previous timestamps gives the time spent in the event queue.
+     *
+     * @return A time point, default-constructed if not collected.
+     * @since 1.2.0
+     */
+    virtual std::chrono::steady_clock::time_point getDispatchTime() const = 0;
 };
 
 }
@@ -0,0 +1,124 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Reader */
+#include "ObservableCardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Card monitoring engine driving the card detection state machines of many observable readers
+ * with a small and fixed group of worker threads.
+ *
+ * <p>By default, each ObservableCardReader uses its own monitoring thread once the card detection
+ * is started. A reader registered with a reactor doesn't: its monitoring cycle is multiplexed with
+ * the ones of the other registered readers on the reactor's worker threads.
+ *
+ * <p>The semantics of ObservableCardReader::startCardDetection(const DetectionMode),
+ * ObservableCardReader::stopCardDetection(), ObservableCardReader::finalizeCardProcessing() and
+ * of the ObservableCardReader::NotificationMode are unchanged.
+ *
+ * <p>The number of worker threads is set by the implementation providing the reactor.
+ *
+ * @since 1.2.0
+ */
+class CardReaderMonitoringReactor {
+public:
+    /**
+     *
+     */
+    virtual ~CardReaderMonitoringReactor() = default;
+
+    /**
+     * Provides the number of worker threads of the reactor.
+     *
+     * @return A strictly positive int.
+     * @since 1.2.0
+     */
+    virtual int getWorkerCount() const = 0;
+
+    /**
+     * Pins a worker thread to a CPU.
+     *
+     * <p>By default, the worker threads are not pinned. This method must be invoked before start().
+     *
+     * @param workerIndex The index of the worker (0 for the first worker, 1 for the second, etc.).
+     * @param cpuIndex The index of the CPU as known by the operating system.
+     * @throw IllegalArgumentException If one of the indexes is out of range.
+     * @throw IllegalStateException If the reactor is already started.
+     * @throw UnsupportedOperationException If the platform does not support thread pinning.
+     * @since 1.2.0
+     */
+    virtual void setWorkerCpuAffinity(const int workerIndex, const int cpuIndex) = 0;
+
+    /**
+     * Registers an observable reader to be monitored by the reactor.
+     *
+     * <p>If the card detection of the reader is already started, its monitoring is transferred to
+     * the reactor without losing any event.
+     *
+     * @param reader The reader to monitor (should be not null).
+     * @throw IllegalArgumentException If the provided reader is null or is not supported by the
+     *        reactor.
+     * @throw IllegalStateException If the reader is already registered with another reactor.
+     * @since 1.2.0
+     */
+    virtual void registerReader(std::shared_ptr<ObservableCardReader> reader) = 0;
+
+    /**
+     * Unregisters an observable reader.
+     *
+     * <p>If the card detection of the reader is started, the reader switches back to its own
+     * monitoring thread.
+     *
+     * @param reader The reader to unregister (should be not null).
+     * @throw IllegalArgumentException If the provided reader is null.
+     * @since 1.2.0
+     */
+    virtual void unregisterReader(const std::shared_ptr<ObservableCardReader> reader) = 0;
+
+    /**
+     * Provides the current number of registered readers.
+     *
+     * @return A positive int.
+     * @since 1.2.0
+     */
+    virtual int countReaders() const = 0;
+
+    /**
+     * Starts the worker threads.
+     *
+     * <p>This method has no effect if the reactor is already started.
+     *
+     * @since 1.2.0
+     */
+    virtual void start() = 0;
+
+    /**
+     * Stops the worker threads after the completion of the ongoing monitoring steps.
+     *
+     * <p>The card detection of the registered readers is suspended until the next call to start().
+     *
+     * @since 1.2.0
+     */
+    virtual void stop() = 0;
+};
+
+}
+}
+}
@@ -12,14 +12,21 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "CardReader.h"
 
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace reader {
 
+using namespace keyple::core::util::cpp::exception;
+
 /**
  * Configurable card reader providing the methods to manage the card protocols.
  *
@@ -27,6 +34,40 @@ namespace reader {
  */
 class ConfigurableCardReader : virtual public CardReader {
 public:
+    /**
+     * Bit mask of protocol identifiers, each identifier being represented by the bit returned by
+     * protocolMaskOf(const int).
+     *
+     * @since 1.2.0
+     */
+    typedef uint64_t ProtocolMask;
+
+    /**
+     * The maximum number of protocols that can be registered on a reader.
+     *
+     * @since 1.2.0
+     */
+    static constexpr int MAX_PROTOCOL_COUNT = 64;
+
+    /**
+     * Returns the bit mask representing the provided protocol identifier.
+     *
+     * <p>Masks can be combined with the bitwise OR operator.
+     *
+     * @param protocolId A protocol identifier returned by registerProtocol(const std::string&,
+     *        const std::string&) (should be between 0 and MAX_PROTOCOL_COUNT - 1).
+     * @return A non-zero mask with a single bit set.
+     * @throw IllegalArgumentException If the identifier is out of range (a compilation error in
+     *        a constant expression).
+     * @since 1.2.0
+     */
+    static constexpr ProtocolMask protocolMaskOf(const int protocolId)
+    {
+        return protocolId >= 0 && protocolId < MAX_PROTOCOL_COUNT
+                   ? static_cast<ProtocolMask>(1) << protocolId
+                   : throw IllegalArgumentException("The protocol identifier is out of range.");
+    }
+
     /**
      * 
      */
@@ -72,6 +113,119 @@ public:
      * @since 1.0.0
      */
     virtual void deactivateProtocol(const std::string& readerProtocol) = 0;
+
+    /**
+     * Associates the provided reader communication protocol name and the communication protocol
+     * name defined by the application, as activateProtocol(const std::string&, const
+     * std::string&) does, but without activating it, and returns the compact identifier assigned
+     * to this association.
+     *
+     * <p>The strings are only used at configuration time: the identifier is then used by the bulk
+     * activation methods and by the reader on its card detection path.
+     *
+     * <p>Registering an already registered reader protocol updates its card protocol and returns
+     * the same identifier.
+     *
+     * @param readerProtocol The name of the communication protocol as known by the reader.
+     * @param cardProtocol The name of the communication protocol of the card as defined by the
+     *        application.
+     * @return An identifier between 0 and MAX_PROTOCOL_COUNT - 1, stable for the lifetime of the
+     *         reader.
+     * @throw IllegalArgumentException If one of the provided communication protocols is null or
+     *        empty.
+     * @throw ReaderProtocolNotSupportedException If the reader communication protocol is not
+     *        supported.
+     * @throw IllegalStateException If the reader protocol is not registered yet and
+     *        MAX_PROTOCOL_COUNT reader protocols are already registered.
+     * @since 1.2.0
+     */
+    virtual int registerProtocol(const std::string& readerProtocol,
+                                 const std::string& cardProtocol) = 0;
+
+    /**
+     * Activates at once all the registered protocols whose identifier is set in the provided mask.
+     *
+     * <p>The protocols already active remain active.
+     *
+     * @param protocols The combination of protocolMaskOf(const int) values.
+     * @throw IllegalArgumentException If the mask contains an unregistered identifier.
+     * @since 1.2.0
+     */
+    virtual void activateProtocols(const ProtocolMask protocols) = 0;
+
+    /**
+     * Deactivates at once all the registered protocols whose identifier is set in the provided
+     * mask.
+     *
+     * @param protocols The combination of protocolMaskOf(const int) values.
+     * @throw IllegalArgumentException If the mask contains an unregistered identifier.
+     * @since 1.2.0
+     */
+    virtual void deactivateProtocols(const ProtocolMask protocols) = 0;
+
+    /**
+     * Gets the mask of the currently active protocols.
+     *
+     * <p>The protocols activated with activateProtocol(const std::string&, const std::string&)
+     * are registered implicitly and are part of it.
+     *
+     * @return A possibly zero mask.
+     * @since 1.2.0
+     */
+    virtual ProtocolMask getActiveProtocols() const = 0;
+
+    /**
+     * Gets the communication protocol name defined by the application for the provided protocol
+     * identifier.
+     *
+     * @param protocolId A registered protocol identifier.
+     * @return A non-empty string.
+     * @throw IllegalArgumentException If the identifier is not registered.
+     * @since 1.2.0
+     */
+    virtual const std::string& getCardProtocol(const int protocolId) const = 0;
+
+    /**
+     * Enables or disables the adaptive polling of the active protocols.
+     *
+     * <p>Disabled by default: the active protocols are polled in a fixed order defined by the
+     * reader. When enabled, the reader counts how many detected cards match each active protocol
+     * and polls the most frequent protocols first, so as to reduce the average detection time.
+     *
+     * <p>Disabling the adaptive polling restores the fixed order but keeps the statistics.
+     *
+     * @param enabled <b>true</b> to enable the adaptive polling, <b>false</b> otherwise.
+     * @since 1.2.0
+     */
+    virtual void setAdaptiveProtocolPolling(const bool enabled) = 0;
+
+    /**
+     * Gets the number of detected cards that matched the provided protocol since the last reset.
+     *
+     * <p>The statistics are collected only while the adaptive polling is enabled.
+     *
+     * @param protocolId A registered protocol identifier.
+     * @return A positive value.
+     * @throw IllegalArgumentException If the identifier is not registered.
+     * @since 1.2.0
+     */
+    virtual uint64_t getProtocolMatchCount(const int protocolId) const = 0;
+
+    /**
+     * Gets the order in which the active protocols are currently polled.
+     *
+     * @return A not null but possibly empty list of protocol identifiers, the first one being
+     *         polled first.
+     * @since 1.2.0
+     */
+    virtual const std::vector<int> getProtocolPollingOrder() const = 0;
+
+    /**
+     * Resets the statistics of the adaptive polling and restores the fixed polling order.
+     *
+     * @since 1.2.0
+     */
+    virtual void resetProtocolPollingOrder() = 0;
 };
 
 }
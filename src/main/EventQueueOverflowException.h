@@ -0,0 +1,68 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/* Keyple Core Util */
+#include "RuntimeException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Indicates that reader events have been dropped because the event queue of an
+ * ObservableCardReader was full.
+ *
+ * <p>Reported to the calypsonet::terminal::reader::spi::CardReaderObservationExceptionHandlerSpi
+ * without stopping the observation process.
+ *
+ * @since 1.2.0
+ */
+class EventQueueOverflowException final : public RuntimeException {
+public:
+    /**
+     * @param droppedEventCount The total number of events dropped by the reader so far.
+     * @since 1.2.0
+     */
+    EventQueueOverflowException(const uint64_t droppedEventCount)
+    : RuntimeException("The event queue is full, " +
+                       std::to_string(droppedEventCount) +
+                       " event(s) dropped so far."),
+      mDroppedEventCount(droppedEventCount) {}
+
+    /**
+     * Gets the total number of events dropped by the reader so far.
+     *
+     * @return A strictly positive value.
+     * @since 1.2.0
+     */
+    uint64_t getDroppedEventCount() const
+    {
+        return mDroppedEventCount;
+    }
+
+private:
+    /**
+     *
+     */
+    const uint64_t mDroppedEventCount;
+};
+
+}
+}
+}
@@ -0,0 +1,167 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "ByteView.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Owning byte buffer storing up to <b>N</b> bytes inline, without heap allocation, and larger
+ * contents on the heap.
+ *
+ * <p>Intended as the storage of short card responses accessed through a ByteView, such as the
+ * response to the Select Application command (see SmartCard::getSelectApplicationResponseView()),
+ * whose typical size fits in the default inline capacity.
+ *
+ * <p>Copying a buffer copies the bytes: the views on a buffer are only valid as long as it and
+ * until its next assignment.
+ *
+ * @param N The inline capacity in bytes.
+ * @since 1.2.0
+ */
+template <size_t N = 64>
+class InlineByteBuffer final {
+    static_assert(N > 0, "The inline capacity should be strictly positive");
+
+public:
+    /**
+     * Creates an empty buffer.
+     *
+     * @since 1.2.0
+     */
+    InlineByteBuffer() : mInline(), mSize(0) {}
+
+    /**
+     * @param data The address of the first byte to copy (may be null if <b>size</b> is 0).
+     * @param size The number of bytes to copy.
+     * @since 1.2.0
+     */
+    InlineByteBuffer(const uint8_t* data, const size_t size) : mInline(), mSize(0)
+    {
+        assign(data, size);
+    }
+
+    /**
+     * @param bytes The bytes to copy.
+     * @since 1.2.0
+     */
+    explicit InlineByteBuffer(const std::vector<uint8_t>& bytes) : mInline(), mSize(0)
+    {
+        assign(bytes.data(), bytes.size());
+    }
+
+    /**
+     * Replaces the content of the buffer.
+     *
+     * @param data The address of the first byte to copy (may be null if <b>size</b> is 0, should
+     *        not refer to the content of this buffer).
+     * @param size The number of bytes to copy.
+     * @since 1.2.0
+     */
+    void assign(const uint8_t* data, const size_t size)
+    {
+        if (size <= N) {
+            if (size != 0) {
+                std::memcpy(mInline, data, size);
+            }
+            mHeap.clear();
+        } else {
+            mHeap.assign(data, data + size);
+        }
+        mSize = size;
+    }
+
+    /**
+     * @return The address of the first byte.
+     * @since 1.2.0
+     */
+    const uint8_t* data() const
+    {
+        return isInline() ? mInline : mHeap.data();
+    }
+
+    /**
+     * @return The number of bytes.
+     * @since 1.2.0
+     */
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @return <b>true</b> if the buffer contains no byte.
+     * @since 1.2.0
+     */
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @return <b>true</b> if the content is stored inline, i.e. if its size doesn't exceed
+     *         inlineCapacity().
+     * @since 1.2.0
+     */
+    bool isInline() const
+    {
+        return mSize <= N;
+    }
+
+    /**
+     * @return The number of bytes that can be stored without heap allocation.
+     * @since 1.2.0
+     */
+    static constexpr size_t inlineCapacity()
+    {
+        return N;
+    }
+
+    /**
+     * @return A view on the content, valid as long as this buffer and until its next assignment.
+     * @since 1.2.0
+     */
+    ByteView view() const
+    {
+        return ByteView(data(), mSize);
+    }
+
+private:
+    /**
+     *
+     */
+    uint8_t mInline[N];
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mHeap;
+
+    /**
+     *
+     */
+    size_t mSize;
+};
+
+}
+}
+}
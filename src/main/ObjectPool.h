@@ -0,0 +1,131 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Pool of preallocated objects recycled once the last reference to them is released, reusable by
+ * the reader implementations (see ObservableCardReader::setEventPoolCapacity(const int)).
+ *
+ * <p>The objects are allocated once, together with their std::shared_ptr control block, when the
+ * pool is created. acquire() hands out a copy of the std::shared_ptr of an object referenced by
+ * the pool only: in steady state, it performs no heap allocation. The caller re-initializes the
+ * acquired object before publishing it.
+ *
+ * <p>acquire() may be invoked from any thread; the references may be released from any thread.
+ *
+ * @param T The type of the pooled objects (default constructible).
+ * @since 1.2.0
+ */
+template <typename T>
+class ObjectPool final {
+public:
+    /**
+     * Creates a pool and preallocates its objects.
+     *
+     * @param capacity The number of pooled objects (should be positive).
+     * @throw IllegalArgumentException If the capacity is negative.
+     * @since 1.2.0
+     */
+    explicit ObjectPool(const int capacity) : mNextIndex(0)
+    {
+        if (capacity < 0) {
+            throw IllegalArgumentException("The capacity must be positive.");
+        }
+
+        mObjects.reserve(capacity);
+        for (int i = 0; i < capacity; i++) {
+            mObjects.push_back(std::make_shared<T>());
+        }
+    }
+
+    /**
+     * Gets an object no longer referenced outside the pool, or a new, non-pooled object if all
+     * pooled objects are in use.
+     *
+     * @return A not null reference.
+     * @since 1.2.0
+     */
+    std::shared_ptr<T> acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            /* Only the pool hands out references: an object seen unreferenced stays so */
+            for (size_t i = 0; i < mObjects.size(); i++) {
+                const size_t index = (mNextIndex + i) % mObjects.size();
+                if (mObjects[index].use_count() == 1) {
+                    /* Orders the previous holder's accesses before the reuse */
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    mNextIndex = index + 1;
+                    return mObjects[index];
+                }
+            }
+        }
+
+        return std::make_shared<T>();
+    }
+
+    /**
+     * @return The number of pooled objects.
+     * @since 1.2.0
+     */
+    int getCapacity() const
+    {
+        return static_cast<int>(mObjects.size());
+    }
+
+    /**
+     *
+     */
+    ObjectPool(const ObjectPool&) = delete;
+
+    /**
+     *
+     */
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+private:
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::vector<std::shared_ptr<T>> mObjects;
+
+    /**
+     * Index from which the next search starts, to spread the reuse over the objects.
+     */
+    size_t mNextIndex;
+};
+
+}
+}
+}
@@ -12,12 +12,16 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 
 /* Calypsonet Terminal Reader */
 #include "CardReader.h"
+#include "CardReaderBatchObserverSpi.h"
 #include "CardReaderObserverSpi.h"
 #include "CardReaderObservationExceptionHandlerSpi.h"
+#include "TaskExecutorSpi.h"
 
 namespace calypsonet {
 namespace terminal {
@@ -28,6 +32,23 @@ using namespace calypsonet::terminal::reader::spi;
 /**
  * Card reader able to observe the insertion/removal of cards.
  *
+ * <p>Concurrency contract of the observer registry (since 1.2.0):
+ *
+ * <ul>
+ *   <li>addObserver, removeObserver, clearObservers and countObservers may be invoked from any
+ *       thread, including from an observer while it is being notified.
+ *   <li>Each notification iterates over an immutable snapshot of the registered observers taken
+ *       when the event is dispatched. The notification process must never wait for a
+ *       registration change to complete (no lock shared with the registration methods).
+ *   <li>A registration change publishes a new snapshot atomically. It takes effect from the next
+ *       dispatched event: an observer removed during a notification may still receive the event
+ *       being dispatched, an observer added during a notification will only receive the next
+ *       ones.
+ * </ul>
+ *
+ * <p>ObserverRegistry is a reusable, lock-free implementation of this contract, able to store the
+ * registration parameters of each observer (event type mask, batching parameters).
+ *
  * @since 1.0.0
  */
 class ObservableCardReader : virtual public CardReader {
@@ -51,7 +72,20 @@ public:
          *
          * @since 1.0.0
          */
-        SINGLESHOT
+        SINGLESHOT,
+
+        /**
+         * Same as REPEATING, but the reader is re-armed for the next card while the current one is
+         * being finalized.
+         *
+         * <p>The scheduled card selection scenario is staged (requests prepared, protocols
+         * configured) during the processing of the current card, so that the detection of the
+         * next card starts as soon as finalizeCardProcessing() is invoked or the physical channel
+         * is closed.
+         *
+         * @since 1.2.0
+         */
+        REPEATING_PRE_ARMED
     };
 
     /**
@@ -77,6 +111,128 @@ public:
         MATCHED_ONLY
     };
 
+    /**
+     * The options defining how the reader events are delivered to the observers.
+     *
+     * <p>Whatever the mode, each observer receives the events of this reader in the order in which
+     * they occurred.
+     *
+     * @since 1.2.0
+     */
+    enum EventDeliveryMode {
+
+        /**
+         * The observers are notified sequentially and synchronously by the card monitoring thread
+         * (default mode).
+         *
+         * <p>The card monitoring cycle is suspended until all observers have processed the event.
+         *
+         * @since 1.2.0
+         */
+        INLINE,
+
+        /**
+         * The notification of each event to all observers is submitted as a single task to the
+         * provided executor.
+         *
+         * <p>The observers are notified sequentially within the task and the tasks of this reader
+         * are executed one after the other. The card monitoring cycle is not suspended.
+         *
+         * @since 1.2.0
+         */
+        SHARED_EXECUTOR,
+
+        /**
+         * Each observer is assigned its own ordered queue of events, drained by the provided
+         * executor.
+         *
+         * <p>A slow observer only delays its own events, neither those of the other observers nor
+         * the card monitoring cycle.
+         *
+         * @since 1.2.0
+         */
+        PER_OBSERVER_QUEUE
+    };
+
+    /**
+     * The options defining the behavior of a full event queue.
+     *
+     * @since 1.2.0
+     */
+    enum EventQueueOverflowPolicy {
+
+        /**
+         * The card monitoring cycle waits until the queue has room for the new event. No event is
+         * lost.
+         *
+         * @since 1.2.0
+         */
+        BLOCK,
+
+        /**
+         * The oldest pending event is dropped to make room for the new event.
+         *
+         * @since 1.2.0
+         */
+        DROP_OLDEST,
+
+        /**
+         * The new event is dropped.
+         *
+         * @since 1.2.0
+         */
+        DROP_NEWEST,
+
+        /**
+         * A pending CardReaderEvent::CARD_REMOVED event and the insertion event
+         * (CardReaderEvent::CARD_INSERTED or CardReaderEvent::CARD_MATCHED) preceding it in the
+         * queue are both dropped, since they relate to a card that is no longer present.
+         *
+         * <p>If the queue contains no such pair, the policy falls back to DROP_OLDEST.
+         *
+         * @since 1.2.0
+         */
+        COALESCE_INSERTED_REMOVED
+    };
+
+    /**
+     * The states of the observation process.
+     *
+     * @since 1.2.0
+     */
+    enum ObservationState {
+
+        /**
+         * The observation process is running normally (or has not been started).
+         *
+         * @since 1.2.0
+         */
+        ACTIVE,
+
+        /**
+         * The observation process has failed and is waiting for its next restart attempt.
+         *
+         * @since 1.2.0
+         */
+        RESTARTING,
+
+        /**
+         * The maximum number of consecutive restart attempts has been reached. The next attempt is
+         * postponed until the end of the circuit open duration.
+         *
+         * @since 1.2.0
+         */
+        CIRCUIT_OPEN,
+
+        /**
+         * The observation process has been stopped following an error and will not restart by
+         * itself.
+         *
+         * @since 1.2.0
+         */
+        STOPPED
+    };
+
     /**
      * Sets the exception handler.
      *
@@ -91,22 +247,172 @@ public:
     virtual void setReaderObservationExceptionHandler(
         std::shared_ptr<CardReaderObservationExceptionHandlerSpi> exceptionHandler) = 0;
 
+    /**
+     * Sets the policy restarting automatically the observation process after an error.
+     *
+     * <p>Disabled by default (<b>maxAttempts</b> set to 0): the observation process is stopped at
+     * the first error, as described in
+     * CardReaderObservationExceptionHandlerSpi::onReaderObservationError.
+     *
+     * <p>An EventQueueOverflowException only reports dropped events: it is reported to the
+     * exception handler but never triggers the restart sequence below.
+     *
+     * <p>When enabled, each other error is still reported to the exception handler, then:
+     *
+     * <ul>
+     *   <li>A CardReaderEvent::UNAVAILABLE event is notified and the state becomes
+     *       ObservationState::RESTARTING.
+     *   <li>The restart is attempted after a random delay between 0 and the current backoff
+     *       (full jitter, to avoid simultaneous restarts of many readers). The backoff starts at
+     *       <b>initialBackoff</b> and doubles after each failed attempt, up to <b>maxBackoff</b>.
+     *   <li>After <b>maxAttempts</b> consecutive failed attempts, the state becomes
+     *       ObservationState::CIRCUIT_OPEN and single attempts are made, each one after a random
+     *       delay between 0 and <b>circuitOpenDuration</b> (same full jitter, so that readers
+     *       which failed together, e.g. after a shared USB glitch, do not retry together).
+     *   <li>On success, a CardReaderEvent::AVAILABLE event is notified, the state goes back to
+     *       ObservationState::ACTIVE, the backoff is reset and the card detection resumes with
+     *       its previous DetectionMode.
+     * </ul>
+     *
+     * @param maxAttempts The maximum number of consecutive restart attempts before opening the
+     *        circuit (should be positive, 0 to disable the automatic restart).
+     * @param initialBackoff The backoff before the first attempt (should be positive).
+     * @param maxBackoff The maximum backoff (should be greater or equal to the initial backoff).
+     * @param circuitOpenDuration The maximum delay between two attempts when the circuit is open
+     *        (should be strictly positive).
+     * @throw IllegalArgumentException If one of the parameters is out of range.
+     * @since 1.2.0
+     */
+    virtual void setObservationRestartPolicy(
+        const int maxAttempts,
+        const std::chrono::milliseconds initialBackoff,
+        const std::chrono::milliseconds maxBackoff,
+        const std::chrono::milliseconds circuitOpenDuration) = 0;
+
+    /**
+     * Gets the current state of the observation process.
+     *
+     * @return A non-null value.
+     * @since 1.2.0
+     */
+    virtual ObservationState getObservationState() const = 0;
+
+    /**
+     * Sets the way the reader events are delivered to the observers.
+     *
+     * <p>The default mode is EventDeliveryMode::INLINE.
+     *
+     * <p>The new mode applies to the events that occur after the invocation of this method.
+     *
+     * @param eventDeliveryMode The event delivery mode.
+     * @param executor The executor running the notification tasks (ignored, and may be null, in
+     *        EventDeliveryMode::INLINE mode).
+     * @throw IllegalArgumentException If the executor is null while the mode requires it.
+     * @since 1.2.0
+     */
+    virtual void setEventDeliveryMode(
+        const EventDeliveryMode eventDeliveryMode,
+        std::shared_ptr<TaskExecutorSpi> executor) = 0;
+
+    /**
+     * Bounds the queue of events waiting to be delivered and sets the policy to apply when it is
+     * full.
+     *
+     * <p>The queue sits between the card monitoring cycle and the delivery of the events. It is
+     * unbounded by default. In EventDeliveryMode::PER_OBSERVER_QUEUE mode, the capacity and
+     * the policy apply to each observer's queue. The capacity and the policy also apply to the
+     * queue of a PollableCardReaderEventSource.
+     *
+     * <p>Dropped events are counted (see getDroppedEventCount()) and, if an exception handler is
+     * set, reported to it as an EventQueueOverflowException, without stopping the observation
+     * process.
+     *
+     * @param capacity The maximum number of pending events (should be strictly positive).
+     * @param overflowPolicy The policy to apply when the queue is full.
+     * @throw IllegalArgumentException If the capacity is out of range.
+     * @since 1.2.0
+     */
+    virtual void setEventQueueCapacity(const int capacity,
+                                       const EventQueueOverflowPolicy overflowPolicy) = 0;
+
+    /**
+     * Provides the number of events dropped since the creation of the reader because of the
+     * EventQueueOverflowPolicy.
+     *
+     * @return A positive value.
+     * @since 1.2.0
+     */
+    virtual uint64_t getDroppedEventCount() const = 0;
+
     /**
      * Registers a new observer to be notified when a reader event occurs.
      *
      * <p>The provided observer must implement the CardReaderObserverSpi interface to be able
      * to receive the events produced by this reader (card insertion, removal, etc.)
      *
+     * <p>The observer is taken into account from the next dispatched event. This method never
+     * blocks an ongoing notification.
+     *
      * @param observer An observer object implementing the required interface (should be not null).
      * @throw IllegalArgumentException If the provided observer is null.
      * @since 1.0.0
      */
     virtual void addObserver(std::shared_ptr<CardReaderObserverSpi> observer) = 0;
 
+    /**
+     * Registers a new observer to be notified only of the reader events of the provided types.
+     *
+     * <p>Registering an observer with addObserver(std::shared_ptr<CardReaderObserverSpi>) is
+     * equivalent to registering it with CardReaderEvent::maskOfAll().
+     *
+     * <p>Registering an observer already registered replaces its mask.
+     *
+     * <p>The reader computes the union of the masks of all event consumers and neither builds nor
+     * dispatches the events whose type is not part of it. The batch observers and, if the reader
+     * is a PollableCardReaderEventSource, its event queue count as CardReaderEvent::maskOfAll().
+     * The card selection scenario possibly scheduled is executed regardless of the masks.
+     *
+     * @param observer An observer object implementing the required interface (should be not null).
+     * @param eventTypes The combination of CardReaderEvent::maskOf(const Type) values of the
+     *        event types to be notified (should be not zero).
+     * @throw IllegalArgumentException If the provided observer is null or if the mask is zero or
+     *        contains unknown bits.
+     * @since 1.2.0
+     */
+    virtual void addObserver(std::shared_ptr<CardReaderObserverSpi> observer,
+                             const CardReaderEvent::TypeMask eventTypes) = 0;
+
+    /**
+     * Registers a new observer to be notified by batches of reader events.
+     *
+     * <p>The events are accumulated and delivered in a single call to
+     * CardReaderBatchObserverSpi::onReaderEvents as soon as <b>maxBatchSize</b> events are
+     * pending or <b>maxBatchDelay</b> has elapsed since the first pending event, whichever comes
+     * first.
+     *
+     * <p>The batches are delivered according to the current EventDeliveryMode and the observer
+     * registry follows the same concurrency contract as for the other observers.
+     *
+     * <p>Registering an observer already registered replaces its batching parameters.
+     *
+     * @param observer An observer object implementing the required interface (should be not null).
+     * @param maxBatchSize The maximum number of events in a batch (should be strictly positive).
+     * @param maxBatchDelay The maximum time an event may wait before being delivered (should be
+     *        positive, 0 means no waiting).
+     * @throw IllegalArgumentException If the provided observer is null or if one of the batching
+     *        parameters is out of range.
+     * @since 1.2.0
+     */
+    virtual void addBatchObserver(std::shared_ptr<CardReaderBatchObserverSpi> observer,
+                                  const int maxBatchSize,
+                                  const std::chrono::milliseconds maxBatchDelay) = 0;
+
     /**
      * Unregisters a reader observer.
      *
-     * <p>The observer will no longer receive any of the events produced by this reader.
+     * <p>The observer will no longer receive any of the events produced by this reader, except
+     * possibly the event whose notification is in progress. This method never blocks an ongoing
+     * notification.
      *
      * @param observer The observer object to be removed (should be not null).
      * @throw IllegalArgumentException If the provided observer is null.
@@ -115,20 +421,122 @@ public:
     virtual void removeObserver(const std::shared_ptr<CardReaderObserverSpi> observer) = 0;
 
     /**
-     * Unregisters all observers at once.
+     * Unregisters a batch reader observer.
+     *
+     * <p>The pending events not yet delivered to the observer are discarded. Same concurrency
+     * contract as removeObserver(const std::shared_ptr<CardReaderObserverSpi>).
+     *
+     * @param observer The observer object to be removed (should be not null).
+     * @throw IllegalArgumentException If the provided observer is null.
+     * @since 1.2.0
+     */
+    virtual void removeBatchObserver(
+        const std::shared_ptr<CardReaderBatchObserverSpi> observer) = 0;
+
+    /**
+     * Unregisters all observers at once, including the batch observers.
+     *
+     * <p>Same concurrency contract as removeObserver(const std::shared_ptr<CardReaderObserverSpi>).
      *
      * @since 1.0.0
      */
     virtual void clearObservers() = 0;
 
     /**
-     * Provides the current number of registered observers.
+     * Provides the current number of registered observers, including the batch observers.
+     *
+     * <p>The value is read from the latest published snapshot, without locking.
      *
      * @return An int.
      * @since 1.0.0
      */
     virtual int countObservers() const = 0;
 
+    /**
+     * Sets the debounce parameters merging the bursts of insertions and removals produced by a
+     * card held at the edge of the field into a single logical presence.
+     *
+     * <p>Mainly intended for contactless readers (see CardReader::isContactless()). Disabled by
+     * default (both delays set to 0).
+     *
+     * <ul>
+     *   <li>A card is considered inserted only once it has been continuously present for
+     *       <b>insertionSettleTime</b>. The card selection scenario is executed and the insertion
+     *       event notified only then.
+     *   <li>A card is considered removed only once it has been continuously absent for
+     *       <b>removalHoldTime</b>, or earlier if a card detected again in the meantime turns out
+     *       not to be the same card.
+     *   <li>The power-on data is never used to recognize a card, since it is shared by all the
+     *       cards of a given product. A card detected again during <b>removalHoldTime</b> is
+     *       merged with the previous presence only after its identity has been confirmed: the
+     *       scheduled card selection scenario is executed again and the two presences are merged
+     *       only if the scenario produced, for every selection case, the same result with the same
+     *       select application response (which carries the card's serial number for card
+     *       technologies such as Calypso). In that case, neither a CardReaderEvent::CARD_REMOVED
+     *       event nor a new insertion event is produced.
+     *   <li>If the confirmation fails (communication error, card lost during the exchange), the
+     *       presence is kept and nothing is notified: the hold timer keeps running from the
+     *       first absence and the confirmation is retried at the next detection. If the hold
+     *       timer expires before a successful confirmation, the previous card is notified as
+     *       removed; a card still present is then processed as a new card.
+     *   <li>If the confirmation produces different responses, or if no scenario is scheduled, the
+     *       previous card is notified as removed and the card is processed as a new card, with
+     *       its own insertion event.
+     * </ul>
+     *
+     * <p>Merging a flap costs one execution of the scheduled scenario (or more if confirmations
+     * fail): the debounce suppresses the removal and insertion notifications and their
+     * processing by the application, not the exchanges with the card. Applications whose select
+     * application responses do not identify the card uniquely must not rely on the merge and
+     * should leave <b>removalHoldTime</b> at 0.
+     *
+     * <p>The new parameters apply from the next card detection.
+     *
+     * @param insertionSettleTime The minimum presence time of a card before processing it (should
+     *        be positive).
+     * @param removalHoldTime The minimum absence time of a card before considering it as removed
+     *        (should be positive).
+     * @throw IllegalArgumentException If one of the delays is negative.
+     * @since 1.2.0
+     */
+    virtual void setCardPresenceDebounce(const std::chrono::milliseconds insertionSettleTime,
+                                         const std::chrono::milliseconds removalHoldTime) = 0;
+
+    /**
+     * Enables or disables the collection of the monotonic timestamps carried by the
+     * CardReaderEvent (card detection, selection start and end, dispatch).
+     *
+     * <p>Disabled by default. When disabled, the clock is never read.
+     *
+     * @param enabled <b>true</b> to collect the timestamps, <b>false</b> otherwise.
+     * @since 1.2.0
+     */
+    virtual void setEventTimestampsEnabled(const bool enabled) = 0;
+
+    /**
+     * Sets the number of CardReaderEvent and ScheduledCardSelectionsResponse objects
+     * preallocated and recycled by the reader.
+     *
+     * <p>Pooling is disabled by default (capacity 0). When enabled, the objects provided to the
+     * observers come from the pool and return to it, for reuse, once the last reference to them is
+     * released. If all pooled objects are in use, new ones are allocated normally. ObjectPool is a
+     * reusable implementation of this recycling.
+     *
+     * <p>In steady state, with the EventDeliveryMode::INLINE delivery mode and no batch
+     * observer, the dispatch of the events of a card then requires no heap allocation. The other
+     * delivery modes still allocate the tasks submitted to the TaskExecutorSpi or the entries of
+     * the observer queues, and the batch observers the lists of events; the exchanges with the
+     * card (requests, responses, SmartCard objects of the selection results) are not pooled.
+     *
+     * <p>Keeping a reference to an event is still allowed: the object is simply not recycled as
+     * long as it is referenced.
+     *
+     * @param capacity The number of pooled objects of each kind (should be positive).
+     * @throw IllegalArgumentException If the capacity is negative.
+     * @since 1.2.0
+     */
+    virtual void setEventPoolCapacity(const int capacity) = 0;
+
     /**
      * Starts the card detection. Once activated, the application can be notified of the arrival of
      * a card.
@@ -161,7 +569,8 @@ public:
      * which case it is necessary to explicitly close the channel using this method.
      *
      * <p>In practice, it is recommended to invoke this method in all cases (e.g. in a "finally"
-     * statement) at the end of a card processing whatever the result.
+     * statement) at the end of a card processing whatever the result. In C++, a
+     * CardProcessingGuard can be used to ensure this, including when an exception is thrown.
      *
      * @since 1.0.0
      */
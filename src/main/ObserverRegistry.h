@@ -0,0 +1,316 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+using namespace keyple::core::util::cpp::exception;
+
+static_assert(ATOMIC_POINTER_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "ObserverRegistry requires lock-free atomic pointers and integers");
+
+/**
+ * Default registration attributes of an ObserverRegistry: none.
+ *
+ * @since 1.2.0
+ */
+struct NoObserverAttributes final {};
+
+/**
+ * Copy-on-write registry of observers implementing the concurrency contract of
+ * ObservableCardReader, reusable by the reader implementations.
+ *
+ * <p>Each observer is registered with attributes of type <b>A</b> (e.g. the event type mask of
+ * an observer, or the batching parameters of a batch observer). The observers are identified by
+ * pointer: registering an observer already registered replaces its attributes.
+ *
+ * <p>The notification side takes an immutable snapshot of the entries with getSnapshot() and
+ * iterates over it without holding any lock. The registration side copies the current list,
+ * modifies the copy and publishes it; the registration methods are serialized among themselves
+ * by a mutex never taken by the notification side.
+ *
+ * <p>The publication is lock-free: the current list is referenced by an atomic raw pointer and
+ * getSnapshot() only performs atomic operations (two reader counters, the pointer load and the
+ * reference count increment of the std::shared_ptr). A replaced list is reclaimed by the
+ * registration side once the readers that may still be copying it have left, using two reader
+ * counters alternated by an epoch. A registration change may thus briefly wait for
+ * getSnapshot() calls in progress, never the reverse. The header only compiles on the platforms
+ * where the atomic pointers and integers are always lock-free.
+ *
+ * @param T The observer type.
+ * @param A The type of the registration attributes (copyable).
+ * @since 1.2.0
+ */
+template <typename T, typename A = NoObserverAttributes>
+class ObserverRegistry final {
+public:
+    /**
+     * Registered observer and its registration attributes.
+     *
+     * @since 1.2.0
+     */
+    class Entry final {
+    public:
+        /**
+         * @param observer The observer.
+         * @param attributes The registration attributes.
+         * @since 1.2.0
+         */
+        Entry(const std::shared_ptr<T>& observer, const A& attributes)
+        : mObserver(observer), mAttributes(attributes) {}
+
+        /**
+         * @return A not null reference.
+         * @since 1.2.0
+         */
+        const std::shared_ptr<T>& getObserver() const
+        {
+            return mObserver;
+        }
+
+        /**
+         * @return The registration attributes.
+         * @since 1.2.0
+         */
+        const A& getAttributes() const
+        {
+            return mAttributes;
+        }
+
+    private:
+        /**
+         *
+         */
+        std::shared_ptr<T> mObserver;
+
+        /**
+         *
+         */
+        A mAttributes;
+    };
+
+    /**
+     * Immutable list of entries, in registration order.
+     *
+     * @since 1.2.0
+     */
+    typedef std::vector<Entry> Entries;
+
+    /**
+     * Creates an empty registry.
+     *
+     * @since 1.2.0
+     */
+    ObserverRegistry()
+    : mCurrent(new std::shared_ptr<const Entries>(std::make_shared<const Entries>())), mEpoch(0)
+    {
+        mReaderCounts[0].store(0);
+        mReaderCounts[1].store(0);
+    }
+
+    /**
+     *
+     */
+    ~ObserverRegistry()
+    {
+        delete mCurrent.load();
+    }
+
+    /**
+     * Registers an observer, or replaces the attributes of an observer already registered.
+     *
+     * <p>An observer already registered keeps its position in the registration order.
+     *
+     * @param observer The observer to register (should be not null).
+     * @param attributes The registration attributes.
+     * @return <b>true</b> if the observer has been added, <b>false</b> if it was already
+     *         registered.
+     * @throw IllegalArgumentException If the provided observer is null.
+     * @since 1.2.0
+     */
+    bool add(const std::shared_ptr<T>& observer, const A& attributes = A())
+    {
+        if (observer == nullptr) {
+            throw IllegalArgumentException("The observer must not be null.");
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistrationMutex);
+
+        const std::shared_ptr<const Entries> current = *mCurrent.load();
+        const std::shared_ptr<Entries> next = std::make_shared<Entries>(*current);
+        const auto it = find(*next, observer);
+        const bool added = it == next->end();
+        if (added) {
+            next->push_back(Entry(observer, attributes));
+        } else {
+            *it = Entry(observer, attributes);
+        }
+        publish(next);
+
+        return added;
+    }
+
+    /**
+     * Unregisters an observer.
+     *
+     * @param observer The observer to unregister (should be not null).
+     * @return <b>true</b> if the observer has been removed, <b>false</b> if it was not
+     *         registered.
+     * @throw IllegalArgumentException If the provided observer is null.
+     * @since 1.2.0
+     */
+    bool remove(const std::shared_ptr<T>& observer)
+    {
+        if (observer == nullptr) {
+            throw IllegalArgumentException("The observer must not be null.");
+        }
+
+        std::lock_guard<std::mutex> lock(mRegistrationMutex);
+
+        const std::shared_ptr<const Entries> current = *mCurrent.load();
+        const std::shared_ptr<Entries> next = std::make_shared<Entries>(*current);
+        const auto it = find(*next, observer);
+        if (it == next->end()) {
+            return false;
+        }
+        next->erase(it);
+        publish(next);
+
+        return true;
+    }
+
+    /**
+     * Unregisters all observers at once.
+     *
+     * @since 1.2.0
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mRegistrationMutex);
+
+        publish(std::make_shared<Entries>());
+    }
+
+    /**
+     * Provides the number of observers of the latest published snapshot.
+     *
+     * @return A positive int.
+     * @since 1.2.0
+     */
+    int count() const
+    {
+        return static_cast<int>(getSnapshot()->size());
+    }
+
+    /**
+     * Gets the latest published snapshot of the entries, without locking.
+     *
+     * <p>The snapshot is never modified: it remains valid and unchanged while the registry evolves.
+     *
+     * @return A not null but possibly empty list.
+     * @since 1.2.0
+     */
+    std::shared_ptr<const Entries> getSnapshot() const
+    {
+        unsigned int epoch;
+        for (;;) {
+            epoch = mEpoch.load();
+            mReaderCounts[epoch & 1].fetch_add(1);
+            if (mEpoch.load() == epoch) {
+                break;
+            }
+            /* A registration change has just switched the counters: retry on the new one */
+            mReaderCounts[epoch & 1].fetch_sub(1);
+        }
+
+        const std::shared_ptr<const Entries> snapshot = *mCurrent.load();
+        mReaderCounts[epoch & 1].fetch_sub(1);
+
+        return snapshot;
+    }
+
+    /**
+     *
+     */
+    ObserverRegistry(const ObserverRegistry&) = delete;
+
+    /**
+     *
+     */
+    ObserverRegistry& operator=(const ObserverRegistry&) = delete;
+
+private:
+    /**
+     *
+     */
+    static typename Entries::iterator find(Entries& entries, const std::shared_ptr<T>& observer)
+    {
+        return std::find_if(entries.begin(), entries.end(), [&observer](const Entry& entry) {
+            return entry.getObserver() == observer;
+        });
+    }
+
+    /**
+     * Publishes a new list and reclaims the previous one once no reader can still be copying it.
+     * Invoked with the registration mutex held.
+     */
+    void publish(const std::shared_ptr<const Entries>& entries)
+    {
+        const std::shared_ptr<const Entries>* previous =
+            mCurrent.exchange(new std::shared_ptr<const Entries>(entries));
+
+        /* The readers entering from now on use the other counter and see the new list */
+        const unsigned int epoch = mEpoch.fetch_add(1);
+        while (mReaderCounts[epoch & 1].load() != 0) {
+            std::this_thread::yield();
+        }
+
+        delete previous;
+    }
+
+    /**
+     * Serializes the registration changes only, never taken by the notification side.
+     */
+    std::mutex mRegistrationMutex;
+
+    /**
+     *
+     */
+    std::atomic<const std::shared_ptr<const Entries>*> mCurrent;
+
+    /**
+     *
+     */
+    std::atomic<unsigned int> mEpoch;
+
+    /**
+     * Number of getSnapshot() calls in progress, per epoch parity.
+     */
+    mutable std::atomic<unsigned int> mReaderCounts[2];
+};
+
+}
+}
+}
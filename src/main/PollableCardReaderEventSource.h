@@ -0,0 +1,81 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Optional source of reader events to be integrated into an application event loop (epoll,
+ * poll, select, etc.) without callback thread.
+ *
+ * <p>May be implemented by an ObservableCardReader, for its own events, or by a component
+ * grouping several readers (e.g. a CardReaderMonitoringReactor), for the events of all of them.
+ *
+ * <p>The events are queued in the order in which they occurred and are additionally notified to
+ * the registered observers, if any. The queue always receives every event type: it counts as
+ * CardReaderEvent::maskOfAll() in the event type filtering of the observers (see
+ * ObservableCardReader::addObserver(std::shared_ptr<CardReaderObserverSpi>, const
+ * CardReaderEvent::TypeMask)), so that a reader used only through pollEvent() still produces all
+ * its events.
+ *
+ * <p>The queue is bounded by ObservableCardReader::setEventQueueCapacity and its overflow policy,
+ * in the same way as the observers' queue. If the application stops polling, events are
+ * dropped (or, with the ObservableCardReader::BLOCK policy, the card monitoring cycle waits)
+ * once the capacity is reached. With the default unbounded queue, the application must keep
+ * polling.
+ *
+ * <p>Usage: register the file descriptor in the event loop for read readiness and, once it is
+ * readable, invoke pollEvent() until it returns null.
+ *
+ * @since 1.2.0
+ */
+class PollableCardReaderEventSource {
+public:
+    /**
+     *
+     */
+    virtual ~PollableCardReaderEventSource() = default;
+
+    /**
+     * Gets the file descriptor signaling the availability of events (e.g. an eventfd on Linux).
+     *
+     * <p>The descriptor is readable as long as at least one event is pending. It is owned by the
+     * source: the application must neither read from nor close it.
+     *
+     * @return A valid file descriptor, the same for the whole lifetime of the source.
+     * @throw UnsupportedOperationException If the platform does not provide pollable descriptors.
+     * @since 1.2.0
+     */
+    virtual int getEventFileDescriptor() const = 0;
+
+    /**
+     * Retrieves the oldest pending event, without blocking.
+     *
+     * <p>The file descriptor stops being readable when the last pending event is retrieved.
+     *
+     * @return Null if no event is pending.
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<CardReaderEvent> pollEvent() = 0;
+};
+
+}
+}
+}
@@ -40,7 +40,7 @@ namespace reader {
 // };
 
 // const std::string ReaderApiProperties::VERSION = "1.0";
-static const std::string ReaderApiProperties_VERSION = "1.1";
+static const std::string ReaderApiProperties_VERSION = "1.2";
 
 }
 }
@@ -0,0 +1,184 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+/**
+ * Error codes reported by the exception-free variants of the hot-path reader operations.
+ *
+ * <p>Each error code corresponds to the exception thrown by the throwing variant of the
+ * operation (see getValueOrThrow and
+ * calypsonet::terminal::reader::selection::getSelectionValueOrThrow).
+ *
+ * @since 1.2.0
+ */
+enum class ReaderErrorCode {
+
+    /**
+     * The operation succeeded.
+     *
+     * @since 1.2.0
+     */
+    OK,
+
+    /**
+     * An argument of the operation is invalid, e.g. a null reader (see IllegalArgumentException).
+     *
+     * @since 1.2.0
+     */
+    INVALID_ARGUMENT,
+
+    /**
+     * The communication with the reader has failed (see ReaderCommunicationException).
+     *
+     * @since 1.2.0
+     */
+    READER_COMMUNICATION_FAILURE,
+
+    /**
+     * The communication with the card has failed (see CardCommunicationException).
+     *
+     * @since 1.2.0
+     */
+    CARD_COMMUNICATION_FAILURE,
+
+    /**
+     * The card returned invalid data (see
+     * calypsonet::terminal::reader::selection::InvalidCardResponseException).
+     *
+     * @since 1.2.0
+     */
+    INVALID_CARD_RESPONSE,
+
+    /**
+     * The operation was abandoned because its deadline was exceeded (see
+     * calypsonet::terminal::reader::selection::CardSelectionAbortedException).
+     *
+     * @since 1.2.0
+     */
+    DEADLINE_EXCEEDED,
+
+    /**
+     * The operation was abandoned because its cancellation was requested (see
+     * calypsonet::terminal::reader::selection::CardSelectionAbortedException).
+     *
+     * @since 1.2.0
+     */
+    CANCELLED
+};
+
+/**
+ * Result of an exception-free reader operation: either a value or an error code.
+ *
+ * @param T The type of the value, default-constructible and copyable.
+ * @since 1.2.0
+ */
+template <typename T>
+class ReaderResult final {
+public:
+    /**
+     * Builds a successful result.
+     *
+     * @param value The value.
+     * @return A new result.
+     * @since 1.2.0
+     */
+    static ReaderResult success(const T& value)
+    {
+        return ReaderResult(value, ReaderErrorCode::OK);
+    }
+
+    /**
+     * Builds a failed result.
+     *
+     * @param errorCode The error code (should not be ReaderErrorCode::OK).
+     * @return A new result holding a default-constructed value.
+     * @since 1.2.0
+     */
+    static ReaderResult failure(const ReaderErrorCode errorCode)
+    {
+        return ReaderResult(T(), errorCode);
+    }
+
+    /**
+     * Builds a failed result holding the partial value documented by the operation (e.g. the
+     * timing report of an abandoned card selection).
+     *
+     * @param errorCode The error code (should not be ReaderErrorCode::OK).
+     * @param partialValue The partial value.
+     * @return A new result.
+     * @since 1.2.0
+     */
+    static ReaderResult failure(const ReaderErrorCode errorCode, const T& partialValue)
+    {
+        return ReaderResult(partialValue, errorCode);
+    }
+
+    /**
+     * Indicates whether the operation succeeded.
+     *
+     * @return <b>true</b> if the error code is ReaderErrorCode::OK.
+     * @since 1.2.0
+     */
+    bool isSuccess() const noexcept
+    {
+        return mErrorCode == ReaderErrorCode::OK;
+    }
+
+    /**
+     * Gets the error code.
+     *
+     * @return ReaderErrorCode::OK if the operation succeeded.
+     * @since 1.2.0
+     */
+    ReaderErrorCode getErrorCode() const noexcept
+    {
+        return mErrorCode;
+    }
+
+    /**
+     * Gets the value.
+     *
+     * @return The value, default-constructed if the operation failed, unless the operation
+     *         documents a partial value.
+     * @since 1.2.0
+     */
+    const T& getValue() const noexcept
+    {
+        return mValue;
+    }
+
+private:
+    /**
+     *
+     */
+    ReaderResult(const T& value, const ReaderErrorCode errorCode)
+    : mValue(value), mErrorCode(errorCode) {}
+
+    /**
+     *
+     */
+    T mValue;
+
+    /**
+     *
+     */
+    ReaderErrorCode mErrorCode;
+};
+
+}
+}
+}
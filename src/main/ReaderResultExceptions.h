@@ -0,0 +1,73 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <string>
+
+/* Calypsonet Terminal Reader */
+#include "CardCommunicationException.h"
+#include "ReaderCommunicationException.h"
+#include "ReaderResult.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Gets the value of the ReaderResult of a reader operation or throws the exception corresponding
+ * to its error code.
+ *
+ * <p>Intended for the implementation of the throwing variants of the reader operations (e.g.
+ * CardReader::isCardPresent()) as thin wrappers of the exception-free ones. The card selection
+ * operations use calypsonet::terminal::reader::selection::getSelectionValueOrThrow, which also
+ * handles the selection error codes.
+ *
+ * @param result The result of an exception-free reader operation.
+ * @param context The message of the exception possibly thrown.
+ * @return A copy of the value.
+ * @throw IllegalArgumentException If the error code is ReaderErrorCode::INVALID_ARGUMENT.
+ * @throw ReaderCommunicationException If the error code is
+ *        ReaderErrorCode::READER_COMMUNICATION_FAILURE.
+ * @throw CardCommunicationException If the error code is
+ *        ReaderErrorCode::CARD_COMMUNICATION_FAILURE.
+ * @throw IllegalStateException If the error code is specific to the card selection
+ *        (ReaderErrorCode::INVALID_CARD_RESPONSE, ReaderErrorCode::DEADLINE_EXCEEDED or
+ *        ReaderErrorCode::CANCELLED), which a reader operation never reports.
+ * @since 1.2.0
+ */
+template <typename T>
+T getValueOrThrow(const ReaderResult<T>& result, const std::string& context)
+{
+    switch (result.getErrorCode()) {
+    case ReaderErrorCode::OK:
+        return result.getValue();
+    case ReaderErrorCode::INVALID_ARGUMENT:
+        throw IllegalArgumentException(context);
+    case ReaderErrorCode::READER_COMMUNICATION_FAILURE:
+        throw ReaderCommunicationException(context);
+    case ReaderErrorCode::CARD_COMMUNICATION_FAILURE:
+        throw CardCommunicationException(context);
+    default:
+        throw IllegalStateException(context + " (unexpected error code for a reader operation)");
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,82 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+/* Calypsonet Terminal Reader */
+#include "CardSelectionTimingReport.h"
+
+/* Keyple Core Util */
+#include "RuntimeException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Indicates that the execution of a card selection scenario has been abandoned because its
+ * deadline was exceeded or its cancellation was requested.
+ *
+ * <p>The physical channel has been released when this exception is raised.
+ *
+ * @since 1.2.0
+ */
+class CardSelectionAbortedException final : public RuntimeException {
+public:
+    /**
+     * @param message The message to identify the exception context.
+     * @since 1.2.0
+     */
+    CardSelectionAbortedException(const std::string& message) : RuntimeException(message) {}
+
+    /**
+     * @param message The message to identify the exception context.
+     * @param timingReport The timing report of the abandoned execution (may be null).
+     * @since 1.2.0
+     */
+    CardSelectionAbortedException(const std::string& message,
+                                  const std::shared_ptr<CardSelectionTimingReport> timingReport)
+    : RuntimeException(message), mTimingReport(timingReport) {}
+
+    /**
+     * Gets the timing report of the abandoned execution, up to the abort.
+     *
+     * <p>Always available when the execution exceeded a time budget set with
+     * CardSelectionManager::setTimeBudget(const std::chrono::microseconds, const bool), since the
+     * budget enables the collection of the timing report; its
+     * CardSelectionTimingReport::isBudgetExceeded() method then returns <b>true</b>.
+     *
+     * @return Null if the collection of the timing report was not enabled.
+     * @since 1.2.0
+     */
+    const std::shared_ptr<CardSelectionTimingReport> getTimingReport() const
+    {
+        return mTimingReport;
+    }
+
+private:
+    /**
+     *
+     */
+    std::shared_ptr<CardSelectionTimingReport> mTimingReport;
+};
+
+}
+}
+}
+}
@@ -12,13 +12,21 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 /* Calypsonet Terminal Reader */
 #include "CardReader.h"
 #include "CardSelection.h"
 #include "CardSelectionResult.h"
+#include "CardSelectionScenarioBinaryFormat.h"
+#include "CompiledCardSelectionScenario.h"
 #include "ObservableCardReader.h"
+#include "ReaderResult.h"
 
 namespace calypsonet {
 namespace terminal {
@@ -55,6 +63,9 @@ using NotificationMode = ObservableCardReader::NotificationMode;
  * <p>The logical channel established with the card can be left open (default) or closed after card
  * selection (by using the {@link CardSelectionManager#prepareReleaseChannel()} method).
  *
+ * <p>The card selection manager is a mutable builder and is not thread-safe. A scenario to be
+ * shared between several readers or threads should be compiled with compile().
+ *
  * <p>This service allows to:
  *
  * <ul>
@@ -68,6 +79,38 @@ using NotificationMode = ObservableCardReader::NotificationMode;
  */
 class CardSelectionManager {
 public:
+    /**
+     * The options defining the order in which the selection cases are attempted in the default
+     * (first match) selection mode.
+     *
+     * @since 1.2.0
+     */
+    enum SelectionOrder {
+
+        /**
+         * The cases are attempted in the order in which they were prepared (default).
+         *
+         * @since 1.2.0
+         */
+        FIXED,
+
+        /**
+         * The cases declared mutually exclusive are attempted by decreasing match frequency
+         * observed on the reader executing the scenario.
+         *
+         * @since 1.2.0
+         */
+        ADAPTIVE_PER_READER,
+
+        /**
+         * The cases declared mutually exclusive are attempted by decreasing match frequency
+         * observed on all the readers executing the scenario.
+         *
+         * @since 1.2.0
+         */
+        ADAPTIVE_FLEET_WIDE
+    };
+
     /**
      *
      */
@@ -83,6 +126,142 @@ public:
      */
     virtual void setMultipleSelectionMode() = 0;
 
+    /**
+     * Declares that a prepared selection case is mutually exclusive with all the other cases of
+     * the scenario, i.e. that no card can match both this case and another one.
+     *
+     * <p>Only the cases declared mutually exclusive can be moved by an adaptive SelectionOrder
+     * (see setSelectionOrder(const SelectionOrder)). The declaration is part of the card
+     * selection scenario: it is included in the JSON and binary exports.
+     *
+     * <p>The declaration is the responsibility of the application: declaring exclusive a case
+     * overlapping another one (e.g. a generic AID prefix and a specific AID) makes the selected
+     * case depend on the observed match frequencies.
+     *
+     * @param selectionIndex The index returned by prepareSelection(const
+     *        std::shared_ptr<CardSelection>).
+     * @throw IllegalArgumentException If the index doesn't correspond to a prepared selection case.
+     * @since 1.2.0
+     */
+    virtual void setSelectionMutuallyExclusive(const int selectionIndex) = 0;
+
+    /**
+     * Sets the order in which the selection cases are attempted.
+     *
+     * <p>Only relevant in the default (first match) selection mode: in multiple selection mode,
+     * all cases are attempted in the order in which they were prepared.
+     *
+     * <p><b>Behavior change warning:</b> in first match mode, the order of the cases decides
+     * which case is selected when a card satisfies several of them. To keep the selected case
+     * independent of the order, an adaptive order only moves the cases declared with
+     * setSelectionMutuallyExclusive(const int); the other cases keep the order in which they were
+     * prepared relative to one another. With no case declared mutually exclusive, an adaptive
+     * order behaves as SelectionOrder::FIXED.
+     *
+     * <p>Whatever the order, the indexes used in the CardSelectionResult remain those returned
+     * by prepareSelection(const std::shared_ptr<CardSelection>).
+     *
+     * <p>The order applies to the executions of this manager and to the scenarios compiled
+     * afterwards. Each compiled scenario starts with a copy of the match statistics of this
+     * manager at compile time and then maintains its own statistics, independently of this
+     * manager.
+     *
+     * @param selectionOrder The selection order.
+     * @since 1.2.0
+     */
+    virtual void setSelectionOrder(const SelectionOrder selectionOrder) = 0;
+
+    /**
+     * Gets the number of successful selections of the provided case, all readers included, since
+     * the last reset, for the executions of this manager.
+     *
+     * <p>The statistics are collected only in adaptive selection order.
+     *
+     * @param selectionIndex The index returned by prepareSelection(const
+     *        std::shared_ptr<CardSelection>).
+     * @return A positive value.
+     * @throw IllegalArgumentException If the index doesn't correspond to a prepared selection case.
+     * @since 1.2.0
+     */
+    virtual uint64_t getSelectionMatchCount(const int selectionIndex) const = 0;
+
+    /**
+     * Gets the number of successful selections of the provided case on the provided reader since
+     * the last reset, for the executions of this manager.
+     *
+     * <p>These per-reader statistics drive the SelectionOrder::ADAPTIVE_PER_READER order. They
+     * are collected only in that order.
+     *
+     * @param selectionIndex The index returned by prepareSelection(const
+     *        std::shared_ptr<CardSelection>).
+     * @param readerName The name of the reader (see CardReader::getName()).
+     * @return A positive value, 0 if the reader is unknown.
+     * @throw IllegalArgumentException If the index doesn't correspond to a prepared selection case.
+     * @since 1.2.0
+     */
+    virtual uint64_t getSelectionMatchCount(const int selectionIndex,
+                                            const std::string& readerName) const = 0;
+
+    /**
+     * Resets the match statistics of this manager, fleet-wide and per reader, thus restoring the
+     * order in which the cases were prepared.
+     *
+     * <p>The scenarios already compiled are not affected.
+     *
+     * @since 1.2.0
+     */
+    virtual void resetSelectionMatchCounts() = 0;
+
+    /**
+     * Enables or disables the lazy parsing of the scheduled card selection responses.
+     *
+     * <p>Disabled by default: parseScheduledCardSelectionsResponse builds the SmartCard of all
+     * successful cases. When enabled, only the active case is decoded up front; the SmartCard of
+     * the other cases are built, once, the first time CardSelectionResult::getSmartCards() is
+     * invoked.
+     *
+     * <p>The mode applies to the scenarios compiled afterwards.
+     *
+     * @param enabled <b>true</b> to enable the lazy parsing, <b>false</b> otherwise.
+     * @since 1.2.0
+     */
+    virtual void setLazyResultParsing(const bool enabled) = 0;
+
+    /**
+     * Enables or disables the collection of the timing report attached to the card selection
+     * result (see CardSelectionResult::getTimingReport()).
+     *
+     * <p>Disabled by default. The collection only reads a monotonic clock around each step and is
+     * cheap enough to be left enabled in production. The setting applies to the scenarios compiled
+     * afterwards.
+     *
+     * @param enabled <b>true</b> to collect the timing report, <b>false</b> otherwise.
+     * @since 1.2.0
+     */
+    virtual void setTimingReportEnabled(const bool enabled) = 0;
+
+    /**
+     * Sets the time budget of the scenario execution.
+     *
+     * <p>No budget is set by default. The budget enables the timing report collection. An
+     * execution exceeding the budget is marked in the timing report (see
+     * CardSelectionTimingReport::isBudgetExceeded()) and, if <b>abortOnOverrun</b> is set,
+     * abandoned before its next exchange with the card, the physical channel being released and a
+     * CardSelectionAbortedException being raised (or the ReaderErrorCode::DEADLINE_EXCEEDED
+     * error code reported), both carrying the timing report of the execution. See
+     * scheduleCardSelectionScenario for the scheduled executions. The setting applies to the
+     * scenarios compiled afterwards.
+     *
+     * @param budget The maximum duration of the scenario execution (should be strictly positive,
+     *        zero to remove the budget).
+     * @param abortOnOverrun <b>true</b> to abandon the execution on overrun, <b>false</b> to only
+     *        mark it.
+     * @throw IllegalArgumentException If the budget is negative.
+     * @since 1.2.0
+     */
+    virtual void setTimeBudget(const std::chrono::microseconds budget,
+                               const bool abortOnOverrun) = 0;
+
     /**
      * Appends a card selection case to the card selection scenario.
      *
@@ -97,6 +276,41 @@ public:
      */
     virtual int prepareSelection(const std::shared_ptr<CardSelection> cardSelection) = 0;
 
+    /**
+     * Sets a power-on data prefilter on a prepared card selection case.
+     *
+     * <p>The prefilters of all cases are evaluated, before any APDU is exchanged, against the
+     * power-on data of the card (see SmartCard::getPowerOnData()) decoded from its hexadecimal
+     * form. The cases whose prefilter doesn't match are skipped as unsuccessful, saving their
+     * round-trips.
+     *
+     * <p>A prefilter matches if the power-on data is at least as long as <b>value</b> and if, for
+     * each byte <b>i</b> of <b>value</b>, <code>(powerOnData[i] & mask[i]) == value[i]</code>. An
+     * empty <b>value</b> matches any card.
+     *
+     * <p>The prefilters of all cases are compiled into a single matcher once, when a prefilter is
+     * set (or imported), never during the scenario execution. A scenario compiled with compile()
+     * embeds the matcher already built.
+     *
+     * <p>The prefilters are part of the card selection scenario: they are included in the JSON
+     * (exportCardSelectionScenario()) and binary (exportCardSelectionScenarioAsBinary())
+     * exports and restored by the corresponding imports.
+     *
+     * <p>A card whose power-on data is not available or not hexadecimal is not filtered out.
+     *
+     * @param selectionIndex The index returned by prepareSelection(const
+     *        std::shared_ptr<CardSelection>).
+     * @param value The expected leading bytes of the power-on data, once masked.
+     * @param mask The mask to apply to the power-on data (same length as <b>value</b>).
+     * @throw IllegalArgumentException If the index doesn't correspond to a prepared selection case,
+     *        if <b>value</b> and <b>mask</b> have different lengths or if <b>value</b> has bits
+     *        set outside <b>mask</b> (such a prefilter could never match).
+     * @since 1.2.0
+     */
+    virtual void setPowerOnDataPrefilter(const int selectionIndex,
+                                         const std::vector<uint8_t>& value,
+                                         const std::vector<uint8_t>& mask) = 0;
+
     /**
      * Requests the closing of the physical channel at the end of the execution of the card selection
      * request.
@@ -134,10 +348,89 @@ public:
      */
     virtual int importCardSelectionScenario(const std::string& cardSelectionScenario) = 0;
 
+    /**
+     * Exports the current prepared card selection scenario in a compact binary format.
+     *
+     * <p>The format is versioned: it starts with the header described in
+     * CardSelectionScenarioBinaryFormat.h (magic number CardSelectionScenarioBinaryFormat_MAGIC
+     * and format version CardSelectionScenarioBinaryFormat_VERSION). It holds the same
+     * information as the JSON format: importing either form into a card selection manager
+     * produces the same scenario, which exports to the same JSON and binary forms.
+     *
+     * <p>The card requests are stored pre-encoded, so that the content can be used in place, e.g.
+     * from a memory-mapped file, without parsing nor copying, with
+     * compile(const std::shared_ptr<const uint8_t>, const size_t).
+     *
+     * @return A not empty byte array.
+     * @see importCardSelectionScenario(const uint8_t*, const size_t)
+     * @since 1.2.0
+     */
+    virtual const std::vector<uint8_t> exportCardSelectionScenarioAsBinary() const = 0;
+
+    /**
+     * Imports a card selection scenario provided in the compact binary format.
+     *
+     * <p>The data must have been exported from a card selection manager via the method
+     * exportCardSelectionScenarioAsBinary(). The data is parsed and copied into this manager
+     * and is only read during the invocation. To use the data in place instead, see
+     * compile(const std::shared_ptr<const uint8_t>, const size_t).
+     *
+     * @param cardSelectionScenario The address of the data containing the card selection
+     *        scenario.
+     * @param length The length of the data.
+     * @return The index of the last imported selection in the card selection scenario.
+     * @throw IllegalArgumentException If the data is null, malformed or in an unsupported format
+     *        version.
+     * @see exportCardSelectionScenarioAsBinary()
+     * @since 1.2.0
+     */
+    virtual int importCardSelectionScenario(const uint8_t* cardSelectionScenario,
+                                            const size_t length) = 0;
+
+    /**
+     * Compiles the current prepared card selection scenario into an immutable and thread-safe
+     * object, with its card requests pre-encoded.
+     *
+     * <p>The compiled scenario is independent of this manager: subsequent changes to the manager
+     * do not affect it.
+     *
+     * @return A non-null reference.
+     * @throw IllegalStateException If no card selection case has been prepared.
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<const CompiledCardSelectionScenario> compile() const = 0;
+
+    /**
+     * Builds a compiled card selection scenario directly backed by data in the compact binary
+     * format, without parse-and-copy step and without modifying this manager.
+     *
+     * <p>Only the header and the structure of the data are checked; the pre-encoded card requests
+     * are then read in place by the compiled scenario at each execution.
+     *
+     * <p>Lifetime contract: the compiled scenario keeps a reference to <b>data</b> and reads it
+     * as long as the compiled scenario itself, or any reader on which it has been scheduled, or
+     * any of its pending executions, is alive. The data must not be modified during that time.
+     * For a memory-mapped file, the caller typically provides a std::shared_ptr whose deleter
+     * unmaps the file.
+     *
+     * @param data The data containing the card selection scenario (should be not null).
+     * @param length The length of the data.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the data is null, malformed or in an unsupported format
+     *        version.
+     * @see exportCardSelectionScenarioAsBinary()
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<const CompiledCardSelectionScenario> compile(
+        const std::shared_ptr<const uint8_t> data, const size_t length) const = 0;
+
     /**
      * Explicitely executes a previously prepared card selection scenario and returns the card
      * selection result.
      *
+     * <p>Implementations are expected to be thin wrappers of
+     * tryProcessCardSelectionScenario(std::shared_ptr<CardReader>) (see getSelectionValueOrThrow).
+     *
      * @param reader The reader to communicate with the card.
      * @return A non-null reference.
      * @throw IllegalArgumentException If the provided reader is null.
@@ -147,11 +440,39 @@ public:
      *        code.
      * @throw InvalidCardResponseException If the card returned invalid data during the selection
      *        process.
+     * @throw CardSelectionAbortedException If a time budget with abort on overrun is set (see
+     *        setTimeBudget(const std::chrono::microseconds, const bool)) and the execution has
+     *        exceeded it. The timing report of the execution is available through
+     *        CardSelectionAbortedException::getTimingReport().
      * @since 1.0.0
      */
     virtual const std::shared_ptr<CardSelectionResult> processCardSelectionScenario(
         std::shared_ptr<CardReader> reader) = 0;
 
+    /**
+     * Explicitely executes a previously prepared card selection scenario, without throwing
+     * exceptions.
+     *
+     * <p>Exception-free variant of processCardSelectionScenario(std::shared_ptr<CardReader>)
+     * intended for hot paths, where an aborted selection (e.g. a card removed during the
+     * exchange) is an ordinary runtime condition.
+     *
+     * @param reader The reader to communicate with the card (should be not null).
+     * @return A result holding a non-null reference, or one of the error codes
+     *         ReaderErrorCode::INVALID_ARGUMENT (if the provided reader is null),
+     *         ReaderErrorCode::READER_COMMUNICATION_FAILURE,
+     *         ReaderErrorCode::CARD_COMMUNICATION_FAILURE,
+     *         ReaderErrorCode::INVALID_CARD_RESPONSE and
+     *         ReaderErrorCode::DEADLINE_EXCEEDED (if a time budget with abort on overrun is set,
+     *         see setTimeBudget(const std::chrono::microseconds, const bool), and the execution
+     *         has exceeded it). With ReaderErrorCode::DEADLINE_EXCEEDED, the result holds a
+     *         partial CardSelectionResult with no successful case, whose
+     *         CardSelectionResult::getTimingReport() provides the timing report of the execution.
+     * @since 1.2.0
+     */
+    virtual ReaderResult<std::shared_ptr<CardSelectionResult>> tryProcessCardSelectionScenario(
+        std::shared_ptr<CardReader> reader) noexcept = 0;
+
     /**
      * Schedules the execution of the prepared card selection scenario as soon as a card is
      * presented to the provided ObservableCardReader.
@@ -165,6 +486,16 @@ public:
      * <p>The result of the scenario execution will be analyzed by
      * parseScheduledCardSelectionsResponse(ScheduledCardSelectionsResponse).
      *
+     * <p>If the execution exceeds a time budget with abort on overrun (see
+     * setTimeBudget(const std::chrono::microseconds, const bool)), the physical channel is
+     * released and the card is notified as not matched: a CardReaderEvent::CARD_INSERTED event
+     * is produced in ObservableCardReader::NotificationMode::ALWAYS mode, no event in
+     * ObservableCardReader::NotificationMode::MATCHED_ONLY mode. The response carried by the
+     * event holds the responses obtained before the abort, the cases not attempted being
+     * unsuccessful; the CardSelectionResult parsed from it has no active selection and its
+     * timing report is marked as exceeding the budget (see
+     * CardSelectionTimingReport::isBudgetExceeded()).
+     *
      * @param observableCardReader The reader with which the card communication is carried out.
      * @param detectionMode The card detection mode to use when searching for a card.
      * @param notificationMode The card notification mode to use when a card is detected.
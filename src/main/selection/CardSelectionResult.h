@@ -15,9 +15,12 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 /* Calypsonet Terminal Reader */
+#include "CardSelectionTimingReport.h"
 #include "SmartCard.h"
+#include "SmartCardsView.h"
 
 namespace calypsonet {
 namespace terminal {
@@ -40,16 +43,52 @@ using namespace calypsonet::terminal::reader::selection::spi;
  */
 class CardSelectionResult {
 public:
+    /**
+     *
+     */
+    virtual ~CardSelectionResult() = default;
+
     /**
      * Gets all SmartCard corresponding to all successful selection cases in a map for which
      * the key is the selection index provided by the
      * CardSelectionManager#prepareSelection(CardSelection) method.
      *
+     * <p>If the result was produced with lazy parsing enabled (see
+     * CardSelectionManager::setLazyResultParsing(const bool)), the map is built on the first
+     * invocation of this method, in a thread-safe way.
+     *
      * @return A not null but possibly empty map.
+     * @throw InvalidCardResponseException If the lazy parsing of a non-active case fails.
      * @since 1.0.0
      */
     virtual const std::map<int, std::shared_ptr<SmartCard>>& getSmartCards() const = 0;
 
+    /**
+     * Gets the SmartCard of all selection cases in a contiguous list addressed by the selection
+     * index provided by the CardSelectionManager#prepareSelection(CardSelection) method.
+     *
+     * <p>This is the primary storage of the result: the map returned by getSmartCards() is only
+     * built from it on its first invocation. Lazy parsing applies as for getSmartCards().
+     *
+     * @return A not null list with one entry per selection case of the scenario, null for the
+     *         unsuccessful cases.
+     * @throw InvalidCardResponseException If the lazy parsing of a non-active case fails.
+     * @since 1.2.0
+     */
+    virtual const std::vector<std::shared_ptr<SmartCard>>& getIndexedSmartCards() const = 0;
+
+    /**
+     * Gets a non-allocating view over the successful selection cases of getIndexedSmartCards().
+     *
+     * @return A view valid as long as this result.
+     * @throw InvalidCardResponseException If the lazy parsing of a non-active case fails.
+     * @since 1.2.0
+     */
+    SmartCardsView getSuccessfulSmartCards() const
+    {
+        return SmartCardsView(getIndexedSmartCards());
+    }
+
     /**
      * Gets the active matching card. I.e. the card that has been selected.
      *
@@ -65,6 +104,14 @@ public:
      * @since 1.0.0
      */
     virtual int getActiveSelectionIndex() const = 0;
+
+    /**
+     * Gets the timing report of the execution of the card selection scenario.
+     *
+     * @return Null if the collection of the timing report was not enabled.
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<CardSelectionTimingReport> getTimingReport() const = 0;
 };
 
 }
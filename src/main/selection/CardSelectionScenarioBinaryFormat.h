@@ -0,0 +1,159 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+/**
+ * Length of the magic number of the compact binary format of the card selection scenarios.
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_MAGIC_LENGTH = 4;
+
+/**
+ * Magic number of the compact binary format of the card selection scenarios (see
+ * CardSelectionManager::exportCardSelectionScenarioAsBinary()): the ASCII characters "CNSS".
+ *
+ * <p>Every binary scenario starts with a header made of:
+ *
+ * <ul>
+ *   <li>this magic number (CardSelectionScenarioBinaryFormat_MAGIC_LENGTH bytes),
+ *   <li>the format version, as an unsigned 16-bit big-endian integer.
+ * </ul>
+ *
+ * <p>The content following the header depends on the format version. A reader of the format must
+ * reject a version it doesn't support. The layout of version 1 is described with
+ * CardSelectionScenarioBinaryFormat_VERSION.
+ *
+ * @since 1.2.0
+ */
+static const uint8_t
+    CardSelectionScenarioBinaryFormat_MAGIC[CardSelectionScenarioBinaryFormat_MAGIC_LENGTH] = {
+        0x43, 0x4E, 0x53, 0x53};
+
+/**
+ * Current version of the binary format.
+ *
+ * <p>Layout of version 1. All integers are unsigned and big-endian. All offsets are counted from
+ * the first byte of the data. The case records and the tables start at offsets that are multiples
+ * of CardSelectionScenarioBinaryFormat_ALIGNMENT, the gaps being filled with zeros; no alignment
+ * of the data address itself is required, the integers being read byte by byte (an
+ * implementation may use aligned loads after checking the alignment of the data address).
+ *
+ * <p>Header and scenario descriptor:
+ *
+ * <pre>
+ * offset length field
+ *  0      4     magic number "CNSS"
+ *  4      2     format version (1)
+ *  6      2     scenario flags:
+ *                 bit 0: multiple selection mode (CardSelectionManager::setMultipleSelectionMode())
+ *                 bit 1: channel released after the selection
+ *                        (CardSelectionManager::prepareReleaseChannel())
+ *                 bit 2: lazy result parsing
+ *                 bit 3: timing report enabled
+ *                 bit 4: abort on time budget overrun
+ *                 other bits: 0
+ *  8      1     selection order (CardSelectionManager::SelectionOrder value)
+ *  9      1     reserved (0)
+ * 10      4     time budget in microseconds (0 if none)
+ * 14      2     number N of selection cases (at least 1)
+ * 16      4     total length of the data
+ * 20      4 * N offsets of the case records, in the order in which the cases were prepared
+ * </pre>
+ *
+ * <p>Case record (offsets relative to the start of the record):
+ *
+ * <pre>
+ * offset length field
+ *  0      4     length of the record (padding excluded)
+ *  4      2     case flags:
+ *                 bit 0: mutually exclusive case
+ *                        (CardSelectionManager::setSelectionMutuallyExclusive(const int))
+ *                 other bits: 0
+ *  6      2     number M of pre-encoded card requests (APDUs), in exchange order
+ *  8      2     length P of the power-on data prefilter (0 if none)
+ * 10      2     length C of the card protocol name (0 if any protocol)
+ * 12      2     length T of the card extension type
+ * 14      2     reserved (0)
+ * 16      4     length E of the card extension data
+ * 20      8 * M request table, one entry per card request:
+ *                 4 bytes: offset of the APDU (from the first byte of the data)
+ *                 2 bytes: length of the APDU
+ *                 2 bytes: number S of successful status words
+ * 20+8M   P     prefilter value
+ *         P     prefilter mask
+ *         C     card protocol name (UTF-8)
+ *         T     card extension type (UTF-8), identifying the card extension able to rebuild the
+ *               CardSelection and to parse its responses
+ *         E     card extension data, opaque to the reader
+ *         ...   for each card request, the command APDU as sent to the card (ISO 7816-4)
+ *               immediately followed by its S successful status words (2 bytes each)
+ * </pre>
+ *
+ * <p>The pre-encoded APDUs can thus be sent to the card directly from the data, at the offsets
+ * given by the request tables. A reader of the format must reject data whose total length
+ * doesn't match the provided length, with non-zero reserved fields or unknown flag bits, or with
+ * an offset or a length pointing outside the data or the record.
+ *
+ * @since 1.2.0
+ */
+static const uint16_t CardSelectionScenarioBinaryFormat_VERSION = 1;
+
+/**
+ * Length of the header (magic number and format version).
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_HEADER_LENGTH =
+    CardSelectionScenarioBinaryFormat_MAGIC_LENGTH + 2;
+
+/**
+ * Alignment of the case records in version 1, relative to the first byte of the data.
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_ALIGNMENT = 4;
+
+/**
+ * Offset of the table of the case record offsets in version 1.
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_CASE_TABLE_OFFSET = 20;
+
+/**
+ * Length of the fixed part of a case record in version 1 (before its request table).
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_CASE_HEADER_LENGTH = 20;
+
+/**
+ * Length of an entry of the request table of a case record in version 1.
+ *
+ * @since 1.2.0
+ */
+static const size_t CardSelectionScenarioBinaryFormat_REQUEST_ENTRY_LENGTH = 8;
+
+}
+}
+}
+}
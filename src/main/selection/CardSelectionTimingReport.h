@@ -0,0 +1,97 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+/**
+ * Timing of the execution of a card selection scenario, step by step.
+ *
+ * <p>Provided by CardSelectionResult::getTimingReport() when the collection has been enabled
+ * with CardSelectionManager::setTimingReportEnabled(const bool). The durations are measured with
+ * a monotonic clock.
+ *
+ * @since 1.2.0
+ */
+class CardSelectionTimingReport {
+public:
+    /**
+     *
+     */
+    virtual ~CardSelectionTimingReport() = default;
+
+    /**
+     * Gets the duration of the whole scenario execution.
+     *
+     * @return A positive duration.
+     * @since 1.2.0
+     */
+    virtual std::chrono::microseconds getTotalDuration() const = 0;
+
+    /**
+     * Gets the duration of the opening of the physical channel.
+     *
+     * @return A positive duration, zero if the channel was already open.
+     * @since 1.2.0
+     */
+    virtual std::chrono::microseconds getChannelOpeningDuration() const = 0;
+
+    /**
+     * Gets the duration of the closing of the physical channel.
+     *
+     * @return A positive duration, zero if the channel was left open.
+     * @since 1.2.0
+     */
+    virtual std::chrono::microseconds getChannelClosingDuration() const = 0;
+
+    /**
+     * Gets the duration of the selection step (e.g. the Select Application command) of the
+     * provided case.
+     *
+     * @param selectionIndex The index of the selection case.
+     * @return A positive duration, zero if the case was not attempted.
+     * @throw IllegalArgumentException If the index is out of range.
+     * @since 1.2.0
+     */
+    virtual std::chrono::microseconds getSelectionDuration(const int selectionIndex) const = 0;
+
+    /**
+     * Gets the total duration of the additional commands executed after the successful selection
+     * of the provided case.
+     *
+     * @param selectionIndex The index of the selection case.
+     * @return A positive duration, zero if no command was executed.
+     * @throw IllegalArgumentException If the index is out of range.
+     * @since 1.2.0
+     */
+    virtual std::chrono::microseconds getCommandsDuration(const int selectionIndex) const = 0;
+
+    /**
+     * Indicates whether the total duration exceeded the time budget set with
+     * CardSelectionManager::setTimeBudget.
+     *
+     * @return <b>false</b> if no budget was set or if it was met.
+     * @since 1.2.0
+     */
+    virtual bool isBudgetExceeded() const = 0;
+};
+
+}
+}
+}
+}
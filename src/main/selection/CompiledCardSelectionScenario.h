@@ -0,0 +1,285 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "CancellationToken.h"
+#include "CardReader.h"
+#include "CardSelectionResult.h"
+#include "ObservableCardReader.h"
+#include "ReaderResult.h"
+#include "ScheduledCardSelectionsResponse.h"
+#include "TaskExecutorSpi.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+
+/**
+ * Immutable card selection scenario, with its card requests pre-encoded, produced by
+ * CardSelectionManager::compile().
+ *
+ * <p>Unlike the CardSelectionManager it comes from, a compiled scenario is thread-safe: the same
+ * instance can be executed concurrently on any number of readers, without copying, from any
+ * number of threads.
+ *
+ * @since 1.2.0
+ */
+class CompiledCardSelectionScenario {
+public:
+    /**
+     *
+     */
+    virtual ~CompiledCardSelectionScenario() = default;
+
+    /**
+     * Gets the number of selection cases of the scenario.
+     *
+     * @return A positive int.
+     * @since 1.2.0
+     */
+    virtual int getSelectionCount() const = 0;
+
+    /**
+     * Gets the number of successful selections of the provided case, all readers included, since
+     * the last reset.
+     *
+     * <p>The match statistics used by the adaptive selection orders (see
+     * CardSelectionManager::setSelectionOrder) are the only mutable state of a compiled scenario.
+     * They are owned by the compiled scenario (initialized with a copy of the statistics of the
+     * manager at compile time) and updated atomically.
+     *
+     * @param selectionIndex The index of the selection case.
+     * @return A positive value.
+     * @throw IllegalArgumentException If the index is out of range.
+     * @since 1.2.0
+     */
+    virtual uint64_t getSelectionMatchCount(const int selectionIndex) const = 0;
+
+    /**
+     * Gets the number of successful selections of the provided case on the provided reader since
+     * the last reset.
+     *
+     * <p>These per-reader statistics drive the CardSelectionManager::ADAPTIVE_PER_READER order.
+     *
+     * @param selectionIndex The index of the selection case.
+     * @param readerName The name of the reader (see CardReader::getName()).
+     * @return A positive value, 0 if the reader is unknown.
+     * @throw IllegalArgumentException If the index is out of range.
+     * @since 1.2.0
+     */
+    virtual uint64_t getSelectionMatchCount(const int selectionIndex,
+                                            const std::string& readerName) const = 0;
+
+    /**
+     * Resets the match statistics of this compiled scenario, fleet-wide and per reader, thus
+     * restoring the order in which the cases were prepared.
+     *
+     * @since 1.2.0
+     */
+    virtual void resetSelectionMatchCounts() const = 0;
+
+    /**
+     * Explicitely executes the scenario on the provided reader and returns the card selection
+     * result.
+     *
+     * <p>Same behavior as
+     * CardSelectionManager::processCardSelectionScenario(std::shared_ptr<CardReader>).
+     *
+     * @param reader The reader to communicate with the card.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided reader is null.
+     * @throw ReaderCommunicationException If the communication with the reader has failed.
+     * @throw CardCommunicationException If communication with the card has failed or if the status
+     *        word check is enabled in the card request and the card has returned an unexpected
+     *        code.
+     * @throw InvalidCardResponseException If the card returned invalid data during the selection
+     *        process.
+     * @throw CardSelectionAbortedException If a time budget with abort on overrun is set (see
+     *        CardSelectionManager::setTimeBudget(const std::chrono::microseconds,
+     *        const bool)) and the execution has exceeded it. The timing report of the execution
+     *        is available through CardSelectionAbortedException::getTimingReport().
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult> processCardSelectionScenario(
+        std::shared_ptr<CardReader> reader) const = 0;
+
+    /**
+     * Explicitely executes the scenario on the provided reader, without throwing exceptions.
+     *
+     * <p>Same behavior as
+     * CardSelectionManager::tryProcessCardSelectionScenario(std::shared_ptr<CardReader>).
+     *
+     * @param reader The reader to communicate with the card (should be not null).
+     * @return A result holding a non-null reference, or one of the error codes
+     *         ReaderErrorCode::INVALID_ARGUMENT (if the provided reader is null),
+     *         ReaderErrorCode::READER_COMMUNICATION_FAILURE,
+     *         ReaderErrorCode::CARD_COMMUNICATION_FAILURE,
+     *         ReaderErrorCode::INVALID_CARD_RESPONSE and
+     *         ReaderErrorCode::DEADLINE_EXCEEDED (if a time budget with abort on overrun is set,
+     *         see CardSelectionManager::setTimeBudget(const std::chrono::microseconds,
+     *         const bool), and the execution has exceeded it). With
+     *         ReaderErrorCode::DEADLINE_EXCEEDED, the result holds a partial CardSelectionResult
+     *         with no successful case, whose CardSelectionResult::getTimingReport() provides the
+     *         timing report of the execution.
+     * @since 1.2.0
+     */
+    virtual ReaderResult<std::shared_ptr<CardSelectionResult>> tryProcessCardSelectionScenario(
+        std::shared_ptr<CardReader> reader) const noexcept = 0;
+
+    /**
+     * Executes the scenario asynchronously on the provided reader, within a deadline and with the
+     * possibility of cancelling it.
+     *
+     * <p>The execution is submitted as a task to the provided executor and this method returns
+     * immediately. The deadline and the cancellation token are checked before each exchange with
+     * the card: once the deadline is exceeded or the cancellation requested, the execution is
+     * abandoned cleanly, the physical channel being released.
+     *
+     * @param reader The reader to communicate with the card (should be not null).
+     * @param executor The executor running the execution (should be not null).
+     * @param deadline The time after which the execution is abandoned.
+     * @param cancellationToken The token to cancel the execution (may be null if the execution is
+     *        not cancellable).
+     * @return A future providing the non-null card selection result or rethrowing the exception
+     *         documented in processCardSelectionScenario(std::shared_ptr<CardReader>), or a
+     *         CardSelectionAbortedException if the execution was abandoned.
+     * @throw IllegalArgumentException If the reader or the executor is null.
+     * @since 1.2.0
+     */
+    virtual std::future<std::shared_ptr<CardSelectionResult>> processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        const std::chrono::steady_clock::time_point deadline,
+        std::shared_ptr<CancellationToken> cancellationToken) const = 0;
+
+    /**
+     * Executes the scenario asynchronously on the provided reader, within a deadline and with the
+     * possibility of cancelling it, and reports the result through a completion callback.
+     *
+     * <p>Same behavior as processCardSelectionScenarioAsync(std::shared_ptr<CardReader>,
+     * std::shared_ptr<TaskExecutorSpi>, const std::chrono::steady_clock::time_point,
+     * std::shared_ptr<CancellationToken>). An abandoned execution is reported with the
+     * ReaderErrorCode::DEADLINE_EXCEEDED or ReaderErrorCode::CANCELLED error code.
+     *
+     * @param reader The reader to communicate with the card (should be not null).
+     * @param executor The executor running the execution (should be not null).
+     * @param deadline The time after which the execution is abandoned.
+     * @param cancellationToken The token to cancel the execution (may be null if the execution is
+     *        not cancellable).
+     * @param onCompletion The callback receiving the result, invoked from the executor thread
+     *        (should be not null).
+     * @throw IllegalArgumentException If the reader, the executor or the callback is null.
+     * @since 1.2.0
+     */
+    virtual void processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        const std::chrono::steady_clock::time_point deadline,
+        std::shared_ptr<CancellationToken> cancellationToken,
+        const std::function<void(const ReaderResult<std::shared_ptr<CardSelectionResult>>& result)>&
+            onCompletion) const = 0;
+
+    /**
+     * Executes the scenario on several readers in parallel.
+     *
+     * <p>The execution on each reader is submitted as a separate, blocking task to the provided
+     * executor (typically a thread pool). This method returns without waiting for the executions
+     * to complete.
+     *
+     * @param readers The readers to communicate with the cards (should be not null).
+     * @param executor The executor running the executions (should be not null).
+     * @return A list of futures in the same order as the readers. Each future provides the
+     *         non-null card selection result of the corresponding reader or rethrows the exception
+     *         documented in processCardSelectionScenario(std::shared_ptr<CardReader>).
+     * @throw IllegalArgumentException If one of the readers or the executor is null.
+     * @since 1.2.0
+     */
+    virtual std::vector<std::future<std::shared_ptr<CardSelectionResult>>>
+        processCardSelectionScenario(
+            const std::vector<std::shared_ptr<CardReader>>& readers,
+            std::shared_ptr<TaskExecutorSpi> executor) const = 0;
+
+    /**
+     * Executes the scenario on several readers in parallel and reports each result through a
+     * completion callback.
+     *
+     * <p>The execution on each reader is submitted as a separate task to the provided executor.
+     * The callback is invoked from the executor threads, possibly concurrently, once per reader,
+     * with the index of the reader in the provided list and its result. This method returns
+     * without waiting for the executions to complete.
+     *
+     * @param readers The readers to communicate with the cards (should be not null).
+     * @param executor The executor running the executions (should be not null).
+     * @param onCompletion The callback receiving the result of each reader (should be not null).
+     * @throw IllegalArgumentException If one of the parameters or one of the readers is null.
+     * @since 1.2.0
+     */
+    virtual void processCardSelectionScenario(
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        const std::function<void(
+            const size_t readerIndex,
+            const ReaderResult<std::shared_ptr<CardSelectionResult>>& result)>& onCompletion)
+        const = 0;
+
+    /**
+     * Schedules the execution of the scenario as soon as a card is presented to the provided
+     * ObservableCardReader.
+     *
+     * <p>Same behavior as CardSelectionManager::scheduleCardSelectionScenario. The reader keeps a
+     * reference to this shared instance rather than a copy of the scenario.
+     *
+     * @param observableCardReader The reader with which the card communication is carried out.
+     * @param detectionMode The card detection mode to use when searching for a card.
+     * @param notificationMode The card notification mode to use when a card is detected.
+     * @throw IllegalArgumentException If one of the parameters is null.
+     * @since 1.2.0
+     */
+    virtual void scheduleCardSelectionScenario(
+        std::shared_ptr<ObservableCardReader> observableCardReader,
+        const ObservableCardReader::DetectionMode detectionMode,
+        const ObservableCardReader::NotificationMode notificationMode) const = 0;
+
+    /**
+     * Analyzes the responses provided by a calypsonet::terminal::reader::CardReaderEvent
+     * following the execution of this scenario.
+     *
+     * @param scheduledCardSelectionsResponse The card selection scenario execution response.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided card selection response is null.
+     * @throw InvalidCardResponseException If the data returned by the card could not be interpreted.
+     * @since 1.2.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult> parseScheduledCardSelectionsResponse(
+        const std::shared_ptr<ScheduledCardSelectionsResponse> scheduledCardSelectionsResponse)
+        const = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,102 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+/* Calypsonet Terminal Reader */
+#include "CardSelectionAbortedException.h"
+#include "CardSelectionResult.h"
+#include "InvalidCardResponseException.h"
+#include "ReaderResult.h"
+#include "ReaderResultExceptions.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+using namespace calypsonet::terminal::reader;
+
+/**
+ * Gets the value of the ReaderResult of a card selection operation or throws the exception
+ * corresponding to its error code.
+ *
+ * <p>Intended for the implementation of the throwing variants of the card selection operations
+ * as thin wrappers of the exception-free ones. Extends
+ * calypsonet::terminal::reader::getValueOrThrow with the selection error codes.
+ *
+ * @param result The result of an exception-free card selection operation.
+ * @param context The message of the exception possibly thrown.
+ * @return A copy of the value.
+ * @throw IllegalArgumentException If the error code is ReaderErrorCode::INVALID_ARGUMENT.
+ * @throw ReaderCommunicationException If the error code is
+ *        ReaderErrorCode::READER_COMMUNICATION_FAILURE.
+ * @throw CardCommunicationException If the error code is
+ *        ReaderErrorCode::CARD_COMMUNICATION_FAILURE.
+ * @throw InvalidCardResponseException If the error code is ReaderErrorCode::INVALID_CARD_RESPONSE.
+ * @throw CardSelectionAbortedException If the error code is ReaderErrorCode::DEADLINE_EXCEEDED or
+ *        ReaderErrorCode::CANCELLED.
+ * @since 1.2.0
+ */
+template <typename T>
+T getSelectionValueOrThrow(const ReaderResult<T>& result, const std::string& context)
+{
+    switch (result.getErrorCode()) {
+    case ReaderErrorCode::INVALID_CARD_RESPONSE:
+        throw InvalidCardResponseException(context);
+    case ReaderErrorCode::DEADLINE_EXCEEDED:
+    case ReaderErrorCode::CANCELLED:
+        throw CardSelectionAbortedException(context);
+    default:
+        return getValueOrThrow(result, context);
+    }
+}
+
+/**
+ * Gets the card selection result of a card selection scenario execution or throws the exception
+ * corresponding to its error code.
+ *
+ * <p>Same as the generic getSelectionValueOrThrow, except that the CardSelectionAbortedException
+ * thrown for ReaderErrorCode::DEADLINE_EXCEEDED carries the timing report of the partial result
+ * (see CardSelectionAbortedException::getTimingReport()).
+ *
+ * @param result The result of an exception-free card selection scenario execution.
+ * @param context The message of the exception possibly thrown.
+ * @return A copy of the value.
+ * @throw IllegalArgumentException If the error code is ReaderErrorCode::INVALID_ARGUMENT.
+ * @throw ReaderCommunicationException If the error code is
+ *        ReaderErrorCode::READER_COMMUNICATION_FAILURE.
+ * @throw CardCommunicationException If the error code is
+ *        ReaderErrorCode::CARD_COMMUNICATION_FAILURE.
+ * @throw InvalidCardResponseException If the error code is ReaderErrorCode::INVALID_CARD_RESPONSE.
+ * @throw CardSelectionAbortedException If the error code is ReaderErrorCode::DEADLINE_EXCEEDED or
+ *        ReaderErrorCode::CANCELLED.
+ * @since 1.2.0
+ */
+inline std::shared_ptr<CardSelectionResult> getSelectionValueOrThrow(
+    const ReaderResult<std::shared_ptr<CardSelectionResult>>& result, const std::string& context)
+{
+    if (result.getErrorCode() == ReaderErrorCode::DEADLINE_EXCEEDED &&
+        result.getValue() != nullptr) {
+        throw CardSelectionAbortedException(context, result.getValue()->getTimingReport());
+    }
+
+    return getSelectionValueOrThrow<std::shared_ptr<CardSelectionResult>>(result, context);
+}
+
+}
+}
+}
+}
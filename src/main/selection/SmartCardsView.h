@@ -0,0 +1,214 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "SmartCard.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace selection {
+
+using namespace calypsonet::terminal::reader::selection::spi;
+
+/**
+ * Non-owning view over the successful selection cases of an index-addressed list of SmartCard,
+ * skipping the null entries of the unsuccessful cases.
+ *
+ * <p>Iterating doesn't allocate. The view is only valid as long as the list it refers to.
+ *
+ * <pre>
+ * for (auto it = view.begin(); it != view.end(); ++it) {
+ *     // it.getSelectionIndex(), *it
+ * }
+ * </pre>
+ *
+ * @since 1.2.0
+ */
+class SmartCardsView final {
+public:
+    /**
+     * Forward iterator over the non-null entries.
+     *
+     * @since 1.2.0
+     */
+    class Iterator final {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::shared_ptr<SmartCard> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::shared_ptr<SmartCard>* pointer;
+        typedef const std::shared_ptr<SmartCard>& reference;
+
+        /**
+         * Constructs a singular iterator, only comparable with another singular iterator.
+         *
+         * @since 1.2.0
+         */
+        Iterator() : mSmartCards(nullptr), mIndex(0) {}
+
+        /**
+         * Gets the selection index of the current entry.
+         *
+         * @return A positive int.
+         * @since 1.2.0
+         */
+        int getSelectionIndex() const
+        {
+            return static_cast<int>(mIndex);
+        }
+
+        /**
+         *
+         */
+        reference operator*() const
+        {
+            return (*mSmartCards)[mIndex];
+        }
+
+        /**
+         *
+         */
+        pointer operator->() const
+        {
+            return &(*mSmartCards)[mIndex];
+        }
+
+        /**
+         *
+         */
+        Iterator& operator++()
+        {
+            ++mIndex;
+            skipNullEntries();
+            return *this;
+        }
+
+        /**
+         *
+         */
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        /**
+         *
+         */
+        bool operator==(const Iterator& other) const
+        {
+            return mSmartCards == other.mSmartCards && mIndex == other.mIndex;
+        }
+
+        /**
+         *
+         */
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class SmartCardsView;
+
+        /**
+         *
+         */
+        Iterator(const std::vector<std::shared_ptr<SmartCard>>* smartCards, const size_t index)
+        : mSmartCards(smartCards), mIndex(index)
+        {
+            skipNullEntries();
+        }
+
+        /**
+         *
+         */
+        void skipNullEntries()
+        {
+            while (mIndex < mSmartCards->size() && (*mSmartCards)[mIndex] == nullptr) {
+                ++mIndex;
+            }
+        }
+
+        /**
+         *
+         */
+        const std::vector<std::shared_ptr<SmartCard>>* mSmartCards;
+
+        /**
+         *
+         */
+        size_t mIndex;
+    };
+
+    /**
+     * @param smartCards The index-addressed list of SmartCard, with null entries for the
+     *        unsuccessful cases.
+     * @since 1.2.0
+     */
+    explicit SmartCardsView(const std::vector<std::shared_ptr<SmartCard>>& smartCards)
+    : mSmartCards(&smartCards) {}
+
+    /**
+     * Prevents creating a view on a temporary list, which would dangle immediately.
+     *
+     * @since 1.2.0
+     */
+    SmartCardsView(const std::vector<std::shared_ptr<SmartCard>>&&) = delete;
+
+    /**
+     * @return An iterator on the first successful case.
+     * @since 1.2.0
+     */
+    Iterator begin() const
+    {
+        return Iterator(mSmartCards, 0);
+    }
+
+    /**
+     * @return The past-the-end iterator.
+     * @since 1.2.0
+     */
+    Iterator end() const
+    {
+        return Iterator(mSmartCards, mSmartCards->size());
+    }
+
+    /**
+     * @return <b>true</b> if there is no successful case.
+     * @since 1.2.0
+     */
+    bool empty() const
+    {
+        return begin() == end();
+    }
+
+private:
+    /**
+     *
+     */
+    const std::vector<std::shared_ptr<SmartCard>>* mSmartCards;
+};
+
+}
+}
+}
+}
@@ -16,6 +16,9 @@
 #include <string>
 #include <vector>
 
+/* Calypsonet Terminal Reader */
+#include "ByteView.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace reader {
@@ -36,6 +39,11 @@ namespace spi {
  */
 class SmartCard {
 public:
+    /**
+     *
+     */
+    virtual ~SmartCard() = default;
+
     /**
      * Gets the card's power-on data.
      *
@@ -63,10 +71,26 @@ public:
      * Gets the card data received in response to the Select Application command (including the
      * status word).
      *
+     * <p>The data is returned by copy: getSelectApplicationResponseView() avoids it.
+     *
      * @return Null if no selection application has been performed.
      * @since 1.0.0
      */
     virtual const std::vector<uint8_t> getSelectApplicationResponse() const = 0;
+
+    /**
+     * Gets a view on the card data received in response to the Select Application command
+     * (including the status word), without copying it.
+     *
+     * <p>Intended for callers accessing the response repeatedly. The view points to the storage
+     * owned by this SmartCard and is valid as long as it. Implementations are encouraged to store
+     * the response in an InlineByteBuffer, whose default inline capacity fits typical FCIs, to
+     * avoid a heap allocation.
+     *
+     * @return An empty view if no selection application has been performed.
+     * @since 1.2.0
+     */
+    virtual calypsonet::terminal::reader::ByteView getSelectApplicationResponseView() const = 0;
 };
 
 }
@@ -0,0 +1,64 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace spi {
+
+/**
+ * Reader observer to implement in order to receive the {@link CardReaderEvent} of a
+ * calypsonet::terminal::reader::ObservableCardReader by batches rather than one by one.
+ *
+ * <p>Intended for observers processing events in bulk (audit logging, metrics aggregation,
+ * etc.). The batching parameters are provided when registering the observer with
+ * ObservableCardReader::addBatchObserver(std::shared_ptr<CardReaderBatchObserverSpi>, int,
+ * std::chrono::milliseconds).
+ *
+ * @since 1.2.0
+ */
+class CardReaderBatchObserverSpi {
+public:
+    /**
+     *
+     */
+    virtual ~CardReaderBatchObserverSpi() = default;
+
+    /**
+     * Invoked when a batch of reader events is available.
+     *
+     * <p>A batch is delivered as soon as it reaches the maximum batch size or when the maximum
+     * batch delay has elapsed since the arrival of its first event, whichever comes first.
+     *
+     * <p>The events are contiguous and sorted in the order in which they occurred. Successive
+     * batches of the same reader are delivered sequentially.
+     *
+     * @param readerEvents The not empty list of CardReaderEvent. The reference is only valid
+     *        during the invocation.
+     * @since 1.2.0
+     */
+    virtual void onReaderEvents(
+        const std::vector<std::shared_ptr<CardReaderEvent>>& readerEvents) = 0;
+};
+
+}
+}
+}
+}
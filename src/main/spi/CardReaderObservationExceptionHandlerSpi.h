@@ -35,7 +35,11 @@ public:
     /**
      * Invoked when an error occurs in the observed reader.
      *
-     * <p>When an error occurs, the observation process is stopped.
+     * <p>When an error occurs, the observation process is stopped, except for the
+     * calypsonet::terminal::reader::EventQueueOverflowException which only reports dropped
+     * events, and unless a restart policy has been set with
+     * ObservableCardReader::setObservationRestartPolicy, in which case the observation process is
+     * restarted automatically.
      *
      * @param contextInfo The context information.
      * @param readerName The reader name.
@@ -34,7 +34,9 @@ public:
      * Invoked when a reader event occurs.
      *
      * <p>The event notification should be done <b>sequentially</b> and <b>synchronously</b> but
-     * this may depend on the implementation used.
+     * this may depend on the implementation used and on the
+     * calypsonet::terminal::reader::ObservableCardReader::EventDeliveryMode set on the reader.
+     * In any case, the events of a given reader are received in the order in which they occurred.
      *
      * @param readerEvent The not null CardReaderEvent containing the event data.
      * @since 1.0.0
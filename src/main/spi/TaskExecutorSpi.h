@@ -0,0 +1,68 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+namespace calypsonet {
+namespace terminal {
+namespace reader {
+namespace spi {
+
+/**
+ * General-purpose executor to implement in order to run tasks of the reader API outside of the
+ * calling thread (typically on a thread pool shared by several readers).
+ *
+ * <p>The executor is used for:
+ *
+ * <ul>
+ *   <li>the notification of reader events, when provided to an
+ *       calypsonet::terminal::reader::ObservableCardReader via the
+ *       ObservableCardReader::setEventDeliveryMode(EventDeliveryMode,
+ *       std::shared_ptr<TaskExecutorSpi>) method: short tasks whose duration depends on the
+ *       observers;
+ *   <li>the parallel and asynchronous executions of a
+ *       calypsonet::terminal::reader::selection::CompiledCardSelectionScenario: blocking tasks
+ *       exchanging APDUs with a card, which may last from tens to hundreds of milliseconds.
+ * </ul>
+ *
+ * <p>The executor should be sized according to the number of blocking tasks it may have to run
+ * concurrently, or separate executors should be used for the two kinds of tasks.
+ *
+ * @since 1.2.0
+ */
+class TaskExecutorSpi {
+public:
+    /**
+     *
+     */
+    virtual ~TaskExecutorSpi() = default;
+
+    /**
+     * Submits a task for execution.
+     *
+     * <p>This method must return without waiting for the task to be executed, nor run it in the
+     * calling thread. The task may block (e.g. during card exchanges). The tasks may be executed in
+     * any order and concurrently: the submitter is in charge of any ordering it requires (e.g. the
+     * order of the events of a reader).
+     *
+     * @param task The not null task to execute.
+     * @since 1.2.0
+     */
+    virtual void execute(const std::function<void()>& task) = 0;
+};
+
+}
+}
+}
+}
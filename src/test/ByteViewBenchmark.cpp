@@ -0,0 +1,115 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+/*
+ * Repeated access benchmark of the Select Application response: a card extension reads the
+ * response several times per card tap, either through the by-value getter (one vector copy per
+ * access) or through a view on the InlineByteBuffer owned by the SmartCard (no copy).
+ *
+ * Usage: keypleterminalreader_bench_byteview [accesses per tap]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "ByteView.h"
+#include "InlineByteBuffer.h"
+
+using namespace calypsonet::terminal::reader;
+
+namespace {
+
+const int TAP_COUNT = 1000000;
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Simulated SmartCard storing a typical FCI (about 40 bytes including the status word).
+ */
+class SmartCardStub {
+public:
+    SmartCardStub()
+    {
+        std::vector<uint8_t> fci(40);
+        for (size_t i = 0; i < fci.size(); i++) {
+            fci[i] = static_cast<uint8_t>(i);
+        }
+        mResponseVector = fci;
+        mResponseBuffer.assign(fci.data(), fci.size());
+    }
+
+    const std::vector<uint8_t> getSelectApplicationResponse() const
+    {
+        return mResponseVector;
+    }
+
+    ByteView getSelectApplicationResponseView() const
+    {
+        return mResponseBuffer.view();
+    }
+
+private:
+    std::vector<uint8_t> mResponseVector;
+    InlineByteBuffer<> mResponseBuffer;
+};
+
+/**
+ * Simulates the parsing of the response by a card extension.
+ */
+template <typename Bytes>
+long parse(const Bytes& bytes)
+{
+    return bytes[0] + bytes[bytes.size() - 1] + static_cast<long>(bytes.size());
+}
+
+template <typename Access>
+void run(const char* name, const int accessesPerTap, Access access)
+{
+    const SmartCardStub card;
+    volatile long checksum = 0;
+
+    const Clock::time_point start = Clock::now();
+    for (int tap = 0; tap < TAP_COUNT; tap++) {
+        long sum = 0;
+        for (int i = 0; i < accessesPerTap; i++) {
+            sum += access(card);
+        }
+        checksum = checksum + sum;
+    }
+    const double nanoseconds =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::printf("%-8s accesses/tap=%d  ns/tap=%8.1f  (checksum %ld)\n",
+                name,
+                accessesPerTap,
+                nanoseconds / TAP_COUNT,
+                static_cast<long>(checksum));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const int accessesPerTap = argc > 1 ? std::atoi(argv[1]) : 4;
+
+    run("copy", accessesPerTap, [](const SmartCardStub& card) {
+        return parse(card.getSelectApplicationResponse());
+    });
+    run("view", accessesPerTap, [](const SmartCardStub& card) {
+        return parse(card.getSelectApplicationResponseView());
+    });
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ByteView.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+TEST(ByteViewTest, defaultConstructor_shouldBeEmpty)
+{
+    const ByteView view;
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.size(), 0u);
+    ASSERT_TRUE(view.begin() == view.end());
+    ASSERT_TRUE(view.toVector().empty());
+}
+
+TEST(ByteViewTest, vectorConstructor_shouldReferToVectorStorage)
+{
+    const std::vector<uint8_t> bytes = {0x6F, 0x0A, 0x90, 0x00};
+    const ByteView view(bytes);
+
+    ASSERT_EQ(view.data(), bytes.data());
+    ASSERT_EQ(view.size(), 4u);
+    ASSERT_EQ(view[0], 0x6F);
+    ASSERT_EQ(view[3], 0x00);
+}
+
+TEST(ByteViewTest, toVector_shouldCopyBytes)
+{
+    const uint8_t bytes[] = {0x90, 0x00};
+    const ByteView view(bytes, sizeof(bytes));
+
+    ASSERT_THAT(view.toVector(), ElementsAre(0x90, 0x00));
+}
+
+TEST(ByteViewTest, vectorConstructor_whenVectorIsTemporary_shouldNotCompile)
+{
+    ASSERT_TRUE((std::is_constructible<ByteView, const std::vector<uint8_t>&>::value));
+    ASSERT_FALSE((std::is_constructible<ByteView, std::vector<uint8_t>>::value));
+}
@@ -0,0 +1,286 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+/*
+ * Card-to-card cycle benchmark of the REPEATING and REPEATING_PRE_ARMED detection modes, with a
+ * stub reader and an observer finalizing the card processing with a CardProcessingGuard.
+ *
+ * The card processing (APDU exchanges) and the staging of the next scenario (requests
+ * preparation, protocols configuration) are simulated by waits. In REPEATING mode, the staging
+ * starts after the finalization of the previous card; in REPEATING_PRE_ARMED mode, a staging
+ * thread performs it while the current card is being processed. The measured cycle is compared
+ * with the expected one (processing + staging, or the maximum of both), the difference being the
+ * overhead of the guard and of the handoff between the threads.
+ *
+ * Usage: keypleterminalreader_bench_cycle [card count]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "CardProcessingGuard.h"
+#include "ObservableCardReader.h"
+
+using namespace calypsonet::terminal::reader;
+
+namespace {
+
+const std::chrono::microseconds PROCESSING_DURATION(2000);
+const std::chrono::microseconds STAGING_DURATION(1000);
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Reader stub: only the detection mode and the finalization are implemented.
+ */
+class ObservableCardReaderStub final : public ObservableCardReader {
+public:
+    const std::string& getName() const override
+    {
+        return mName;
+    }
+
+    bool isContactless() override
+    {
+        return true;
+    }
+
+    bool isCardPresent() override
+    {
+        return true;
+    }
+
+    ReaderResult<bool> tryIsCardPresent() noexcept override
+    {
+        return ReaderResult<bool>::success(true);
+    }
+
+    void setReaderObservationExceptionHandler(
+        std::shared_ptr<CardReaderObservationExceptionHandlerSpi>) override {}
+
+    void setObservationRestartPolicy(const int,
+                                     const std::chrono::milliseconds,
+                                     const std::chrono::milliseconds,
+                                     const std::chrono::milliseconds) override {}
+
+    ObservationState getObservationState() const override
+    {
+        return ObservationState::ACTIVE;
+    }
+
+    void setEventDeliveryMode(const EventDeliveryMode, std::shared_ptr<TaskExecutorSpi>) override
+    {
+    }
+
+    void setEventQueueCapacity(const int, const EventQueueOverflowPolicy) override {}
+
+    uint64_t getDroppedEventCount() const override
+    {
+        return 0;
+    }
+
+    void addObserver(std::shared_ptr<CardReaderObserverSpi>) override {}
+
+    void addObserver(std::shared_ptr<CardReaderObserverSpi>,
+                     const CardReaderEvent::TypeMask) override {}
+
+    void addBatchObserver(std::shared_ptr<CardReaderBatchObserverSpi>,
+                          const int,
+                          const std::chrono::milliseconds) override {}
+
+    void removeObserver(const std::shared_ptr<CardReaderObserverSpi>) override {}
+
+    void removeBatchObserver(const std::shared_ptr<CardReaderBatchObserverSpi>) override {}
+
+    void clearObservers() override {}
+
+    int countObservers() const override
+    {
+        return 0;
+    }
+
+    void setCardPresenceDebounce(const std::chrono::milliseconds,
+                                 const std::chrono::milliseconds) override {}
+
+    void setEventTimestampsEnabled(const bool) override {}
+
+    void setEventPoolCapacity(const int) override {}
+
+    void startCardDetection(const DetectionMode detectionMode) override
+    {
+        mDetectionMode = detectionMode;
+    }
+
+    void stopCardDetection() override {}
+
+    void finalizeCardProcessing() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFinalized = true;
+        mCondition.notify_all();
+    }
+
+    DetectionMode getDetectionMode() const
+    {
+        return mDetectionMode;
+    }
+
+    void waitFinalized()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this]() { return mFinalized; });
+        mFinalized = false;
+    }
+
+private:
+    const std::string mName = "READER_1";
+    DetectionMode mDetectionMode = DetectionMode::REPEATING;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mFinalized = false;
+};
+
+/**
+ * Thread staging the scenario for the next card on request.
+ */
+class Stager final {
+public:
+    Stager() : mThread(&Stager::run, this) {}
+
+    ~Stager()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopped = true;
+            mCondition.notify_all();
+        }
+        mThread.join();
+    }
+
+    void request()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRequested = true;
+        mStaged = false;
+        mCondition.notify_all();
+    }
+
+    void waitStaged()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this]() { return mStaged; });
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        for (;;) {
+            mCondition.wait(lock, [this]() { return mRequested || mStopped; });
+            if (mStopped) {
+                return;
+            }
+            mRequested = false;
+            lock.unlock();
+            std::this_thread::sleep_for(STAGING_DURATION);
+            lock.lock();
+            mStaged = true;
+            mCondition.notify_all();
+        }
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mRequested = false;
+    bool mStaged = false;
+    bool mStopped = false;
+    std::thread mThread;
+};
+
+/**
+ * Observer processing a card (delivered inline, on the monitoring thread).
+ */
+void processCard(const std::shared_ptr<ObservableCardReader>& reader)
+{
+    CardProcessingGuard guard(reader);
+    std::this_thread::sleep_for(PROCESSING_DURATION);
+}
+
+void run(const char* name,
+         const ObservableCardReader::DetectionMode detectionMode,
+         const int cardCount)
+{
+    const std::shared_ptr<ObservableCardReaderStub> reader =
+        std::make_shared<ObservableCardReaderStub>();
+    reader->startCardDetection(detectionMode);
+    const bool preArmed =
+        reader->getDetectionMode() == ObservableCardReader::DetectionMode::REPEATING_PRE_ARMED;
+    Stager stager;
+    std::vector<double> cycles;
+
+    if (preArmed) {
+        stager.request();
+    }
+    Clock::time_point cycleStart = Clock::now();
+    for (int card = 0; card < cardCount; card++) {
+        /* Staging of the scenario, then detection of the card (immediate) */
+        if (preArmed) {
+            stager.waitStaged();
+        } else {
+            std::this_thread::sleep_for(STAGING_DURATION);
+        }
+
+        /* Notification */
+        if (preArmed) {
+            stager.request();
+        }
+        processCard(reader);
+        reader->waitFinalized();
+
+        const Clock::time_point cycleEnd = Clock::now();
+        cycles.push_back(std::chrono::duration<double, std::micro>(cycleEnd - cycleStart).count());
+        cycleStart = cycleEnd;
+    }
+
+    const double expected =
+        std::chrono::duration<double, std::micro>(
+            preArmed ? std::max(PROCESSING_DURATION, STAGING_DURATION)
+                     : PROCESSING_DURATION + STAGING_DURATION)
+            .count();
+    std::sort(cycles.begin(), cycles.end());
+    std::printf("%-20s cycle us expected=%7.0f  p50=%7.0f  p99=%7.0f\n",
+                name,
+                expected,
+                cycles[cycles.size() / 2],
+                cycles[cycles.size() * 99 / 100]);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const int cardCount = argc > 1 ? std::atoi(argv[1]) : 200;
+
+    run("REPEATING", ObservableCardReader::DetectionMode::REPEATING, cardCount);
+    run("REPEATING_PRE_ARMED", ObservableCardReader::DetectionMode::REPEATING_PRE_ARMED, cardCount);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <stdexcept>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardProcessingGuard.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+class ObservableCardReaderMock final : public ObservableCardReader {
+public:
+    MOCK_METHOD(const std::string&, getName, (), (const, override));
+    MOCK_METHOD(bool, isContactless, (), (override));
+    MOCK_METHOD(bool, isCardPresent, (), (override));
+    MOCK_METHOD(ReaderResult<bool>, tryIsCardPresent, (), (noexcept, override));
+    MOCK_METHOD(void,
+                setReaderObservationExceptionHandler,
+                (std::shared_ptr<CardReaderObservationExceptionHandlerSpi>),
+                (override));
+    MOCK_METHOD(void,
+                setObservationRestartPolicy,
+                (const int,
+                 const std::chrono::milliseconds,
+                 const std::chrono::milliseconds,
+                 const std::chrono::milliseconds),
+                (override));
+    MOCK_METHOD(ObservationState, getObservationState, (), (const, override));
+    MOCK_METHOD(void,
+                setEventDeliveryMode,
+                (const EventDeliveryMode, std::shared_ptr<TaskExecutorSpi>),
+                (override));
+    MOCK_METHOD(void,
+                setEventQueueCapacity,
+                (const int, const EventQueueOverflowPolicy),
+                (override));
+    MOCK_METHOD(uint64_t, getDroppedEventCount, (), (const, override));
+    MOCK_METHOD(void, addObserver, (std::shared_ptr<CardReaderObserverSpi>), (override));
+    MOCK_METHOD(void,
+                addObserver,
+                (std::shared_ptr<CardReaderObserverSpi>, const CardReaderEvent::TypeMask),
+                (override));
+    MOCK_METHOD(void,
+                addBatchObserver,
+                (std::shared_ptr<CardReaderBatchObserverSpi>,
+                 const int,
+                 const std::chrono::milliseconds),
+                (override));
+    MOCK_METHOD(void,
+                removeObserver,
+                (const std::shared_ptr<CardReaderObserverSpi>),
+                (override));
+    MOCK_METHOD(void,
+                removeBatchObserver,
+                (const std::shared_ptr<CardReaderBatchObserverSpi>),
+                (override));
+    MOCK_METHOD(void, clearObservers, (), (override));
+    MOCK_METHOD(int, countObservers, (), (const, override));
+    MOCK_METHOD(void,
+                setCardPresenceDebounce,
+                (const std::chrono::milliseconds, const std::chrono::milliseconds),
+                (override));
+    MOCK_METHOD(void, setEventTimestampsEnabled, (const bool), (override));
+    MOCK_METHOD(void, setEventPoolCapacity, (const int), (override));
+    MOCK_METHOD(void, startCardDetection, (const DetectionMode), (override));
+    MOCK_METHOD(void, stopCardDetection, (), (override));
+    MOCK_METHOD(void, finalizeCardProcessing, (), (override));
+};
+
+TEST(CardProcessingGuardTest, destructor_whenLeavingScope_shouldFinalizeCardProcessing)
+{
+    auto reader = std::make_shared<ObservableCardReaderMock>();
+    EXPECT_CALL(*reader, finalizeCardProcessing()).Times(1);
+
+    {
+        CardProcessingGuard guard(reader);
+    }
+}
+
+TEST(CardProcessingGuardTest, destructor_whenExceptionIsThrown_shouldFinalizeCardProcessing)
+{
+    auto reader = std::make_shared<ObservableCardReaderMock>();
+    EXPECT_CALL(*reader, finalizeCardProcessing()).Times(1);
+
+    try {
+        CardProcessingGuard guard(reader);
+        throw std::runtime_error("Card removed");
+    } catch (const std::runtime_error&) {
+        /* Expected */
+    }
+}
+
+TEST(CardProcessingGuardTest, destructor_whenFinalizationThrows_shouldNotPropagate)
+{
+    auto reader = std::make_shared<ObservableCardReaderMock>();
+    EXPECT_CALL(*reader, finalizeCardProcessing())
+        .Times(1)
+        .WillOnce(Throw(std::runtime_error("Reader disconnected")));
+
+    ASSERT_NO_THROW({ CardProcessingGuard guard(reader); });
+}
+
+TEST(CardProcessingGuardTest, finalize_shouldFinalizeCardProcessingOnlyOnce)
+{
+    auto reader = std::make_shared<ObservableCardReaderMock>();
+    EXPECT_CALL(*reader, finalizeCardProcessing()).Times(1);
+
+    CardProcessingGuard guard(reader);
+    guard.finalize();
+    guard.finalize();
+}
@@ -0,0 +1,219 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+/*
+ * Dispatch benchmark of the reader events: a stub dispatcher delivers a burst of events to an
+ * observer either one by one (one virtual call and one std::shared_ptr copy per event, as for a
+ * CardReaderObserverSpi) or by batches (the events are appended to a reused list and delivered
+ * in one virtual call per batch, as for a CardReaderBatchObserverSpi).
+ *
+ * The events are preallocated: only the dispatch cost is measured, not the event construction.
+ *
+ * Usage: keypleterminalreader_bench_batch [event count]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderBatchObserverSpi.h"
+#include "CardReaderEvent.h"
+#include "CardReaderObserverSpi.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+
+namespace {
+
+const int REPETITION_COUNT = 100;
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Minimal reader event.
+ */
+class CardReaderEventStub final : public CardReaderEvent {
+public:
+    CardReaderEventStub(const std::string& readerName, const Type type)
+    : mReaderName(readerName), mType(type) {}
+
+    const std::string& getReaderName() const override
+    {
+        return mReaderName;
+    }
+
+    Type getType() const override
+    {
+        return mType;
+    }
+
+    const std::shared_ptr<ScheduledCardSelectionsResponse>
+        getScheduledCardSelectionsResponse() const override
+    {
+        return nullptr;
+    }
+
+    std::chrono::steady_clock::time_point getCardDetectionTime() const override
+    {
+        return std::chrono::steady_clock::time_point();
+    }
+
+    std::chrono::steady_clock::time_point getSelectionStartTime() const override
+    {
+        return std::chrono::steady_clock::time_point();
+    }
+
+    std::chrono::steady_clock::time_point getSelectionEndTime() const override
+    {
+        return std::chrono::steady_clock::time_point();
+    }
+
+    std::chrono::steady_clock::time_point getDispatchTime() const override
+    {
+        return std::chrono::steady_clock::time_point();
+    }
+
+private:
+    const std::string mReaderName;
+    const Type mType;
+};
+
+/**
+ * Observer counting the insertions, as an audit or metrics observer would.
+ */
+class CountingObserver final : public CardReaderObserverSpi {
+public:
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        if (readerEvent->getType() == CardReaderEvent::Type::CARD_INSERTED) {
+            mCount++;
+        }
+    }
+
+    long getCount() const
+    {
+        return mCount;
+    }
+
+private:
+    long mCount = 0;
+};
+
+/**
+ * Same as CountingObserver, by batches.
+ */
+class CountingBatchObserver final : public CardReaderBatchObserverSpi {
+public:
+    void onReaderEvents(const std::vector<std::shared_ptr<CardReaderEvent>>& readerEvents) override
+    {
+        for (const auto& readerEvent : readerEvents) {
+            if (readerEvent->getType() == CardReaderEvent::Type::CARD_INSERTED) {
+                mCount++;
+            }
+        }
+    }
+
+    long getCount() const
+    {
+        return mCount;
+    }
+
+private:
+    long mCount = 0;
+};
+
+std::vector<std::shared_ptr<CardReaderEvent>> createEvents(const int eventCount)
+{
+    std::vector<std::shared_ptr<CardReaderEvent>> events;
+    for (int i = 0; i < eventCount; i++) {
+        const CardReaderEvent::Type type = i % 2 == 0 ? CardReaderEvent::Type::CARD_INSERTED
+                                                      : CardReaderEvent::Type::CARD_REMOVED;
+        events.push_back(std::make_shared<CardReaderEventStub>("READER_1", type));
+    }
+    return events;
+}
+
+void print(const char* name, const int batchSize, const double nanoseconds, const long checksum)
+{
+    std::printf("%-10s batch size=%5d  ns/event=%7.2f  (checksum %ld)\n",
+                name,
+                batchSize,
+                nanoseconds,
+                checksum);
+}
+
+void runPerEvent(const std::vector<std::shared_ptr<CardReaderEvent>>& events)
+{
+    const std::shared_ptr<CountingObserver> counter = std::make_shared<CountingObserver>();
+    const std::shared_ptr<CardReaderObserverSpi> observer = counter;
+
+    const Clock::time_point start = Clock::now();
+    for (int repetition = 0; repetition < REPETITION_COUNT; repetition++) {
+        for (const auto& event : events) {
+            observer->onReaderEvent(event);
+        }
+    }
+    const double nanoseconds =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    print("per-event", 1, nanoseconds / (REPETITION_COUNT * events.size()), counter->getCount());
+}
+
+void runBatched(const std::vector<std::shared_ptr<CardReaderEvent>>& events, const int batchSize)
+{
+    const std::shared_ptr<CountingBatchObserver> counter =
+        std::make_shared<CountingBatchObserver>();
+    const std::shared_ptr<CardReaderBatchObserverSpi> observer = counter;
+    std::vector<std::shared_ptr<CardReaderEvent>> batch;
+    batch.reserve(batchSize);
+
+    const Clock::time_point start = Clock::now();
+    for (int repetition = 0; repetition < REPETITION_COUNT; repetition++) {
+        for (const auto& event : events) {
+            batch.push_back(event);
+            if (static_cast<int>(batch.size()) == batchSize) {
+                observer->onReaderEvents(batch);
+                batch.clear();
+            }
+        }
+        if (!batch.empty()) {
+            observer->onReaderEvents(batch);
+            batch.clear();
+        }
+    }
+    const double nanoseconds =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    print("batched",
+          batchSize,
+          nanoseconds / (REPETITION_COUNT * events.size()),
+          counter->getCount());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const int eventCount = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const std::vector<std::shared_ptr<CardReaderEvent>> events = createEvents(eventCount);
+
+    runPerEvent(events);
+    for (int batchSize = 1; batchSize <= 256; batchSize *= 4) {
+        runBatched(events, batchSize);
+    }
+
+    return 0;
+}
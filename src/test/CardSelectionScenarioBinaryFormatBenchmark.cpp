@@ -0,0 +1,358 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+/*
+ * Size benchmark of the compact binary format of the card selection scenarios (version 1, see
+ * CardSelectionScenarioBinaryFormat.h) against an equivalent JSON form, for typical scenarios.
+ *
+ * A stub encoder writes the binary layout and an equivalent JSON document (same information,
+ * APDUs and byte strings in hexadecimal). A stub in-place reader then checks the structure of the
+ * binary data and walks its request tables without copying, as
+ * CardSelectionManager::compile(const std::shared_ptr<const uint8_t>, const size_t) does; the time
+ * of this check is reported. The pre-encoded APDUs read in place are compared with the encoded
+ * ones.
+ *
+ * Usage: keypleterminalreader_bench_format
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "CardSelectionScenarioBinaryFormat.h"
+
+using namespace calypsonet::terminal::reader::selection;
+
+namespace {
+
+const int OPEN_COUNT = 100000;
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Card request of a selection case.
+ */
+struct Request {
+    std::vector<uint8_t> apdu;
+    std::vector<uint16_t> successfulStatusWords;
+};
+
+/**
+ * Selection case, as known by the card selection manager.
+ */
+struct Case {
+    bool mutuallyExclusive;
+    std::vector<uint8_t> prefilterValue;
+    std::vector<uint8_t> prefilterMask;
+    std::string cardProtocol;
+    std::string extensionType;
+    std::vector<uint8_t> extensionData;
+    std::vector<Request> requests;
+};
+
+void putU8(std::vector<uint8_t>& out, const uint32_t value)
+{
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void putU16(std::vector<uint8_t>& out, const uint32_t value)
+{
+    putU8(out, value >> 8);
+    putU8(out, value);
+}
+
+void putU32(std::vector<uint8_t>& out, const uint32_t value)
+{
+    putU16(out, value >> 16);
+    putU16(out, value);
+}
+
+void setU32(std::vector<uint8_t>& out, const size_t offset, const uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++) {
+        out[offset + i] = static_cast<uint8_t>(value >> (24 - 8 * i));
+    }
+}
+
+uint32_t getU16(const uint8_t* data, const size_t offset)
+{
+    return (static_cast<uint32_t>(data[offset]) << 8) | data[offset + 1];
+}
+
+uint32_t getU32(const uint8_t* data, const size_t offset)
+{
+    return (getU16(data, offset) << 16) | getU16(data, offset + 2);
+}
+
+void pad(std::vector<uint8_t>& out)
+{
+    while (out.size() % CardSelectionScenarioBinaryFormat_ALIGNMENT != 0) {
+        out.push_back(0);
+    }
+}
+
+void append(std::vector<uint8_t>& out, const std::string& value)
+{
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+void append(std::vector<uint8_t>& out, const std::vector<uint8_t>& value)
+{
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+std::vector<uint8_t> encodeBinary(const std::vector<Case>& cases)
+{
+    std::vector<uint8_t> out(CardSelectionScenarioBinaryFormat_MAGIC,
+                             CardSelectionScenarioBinaryFormat_MAGIC +
+                                 CardSelectionScenarioBinaryFormat_MAGIC_LENGTH);
+    putU16(out, CardSelectionScenarioBinaryFormat_VERSION);
+    putU16(out, 0); /* Flags: first match, channel kept open */
+    putU8(out, 0);  /* FIXED order */
+    putU8(out, 0);
+    putU32(out, 0); /* No time budget */
+    putU16(out, static_cast<uint32_t>(cases.size()));
+    putU32(out, 0); /* Total length, set at the end */
+    const size_t caseTable = out.size();
+    out.resize(out.size() + 4 * cases.size());
+
+    for (size_t i = 0; i < cases.size(); i++) {
+        const Case& c = cases[i];
+        pad(out);
+        const size_t record = out.size();
+        setU32(out, caseTable + 4 * i, static_cast<uint32_t>(record));
+        putU32(out, 0); /* Record length, set below */
+        putU16(out, c.mutuallyExclusive ? 1 : 0);
+        putU16(out, static_cast<uint32_t>(c.requests.size()));
+        putU16(out, static_cast<uint32_t>(c.prefilterValue.size()));
+        putU16(out, static_cast<uint32_t>(c.cardProtocol.size()));
+        putU16(out, static_cast<uint32_t>(c.extensionType.size()));
+        putU16(out, 0);
+        putU32(out, static_cast<uint32_t>(c.extensionData.size()));
+        const size_t requestTable = out.size();
+        out.resize(out.size() +
+                   CardSelectionScenarioBinaryFormat_REQUEST_ENTRY_LENGTH * c.requests.size());
+        append(out, c.prefilterValue);
+        append(out, c.prefilterMask);
+        append(out, c.cardProtocol);
+        append(out, c.extensionType);
+        append(out, c.extensionData);
+        for (size_t j = 0; j < c.requests.size(); j++) {
+            const Request& request = c.requests[j];
+            const size_t entry =
+                requestTable + CardSelectionScenarioBinaryFormat_REQUEST_ENTRY_LENGTH * j;
+            setU32(out, entry, static_cast<uint32_t>(out.size()));
+            out[entry + 4] = static_cast<uint8_t>(request.apdu.size() >> 8);
+            out[entry + 5] = static_cast<uint8_t>(request.apdu.size());
+            out[entry + 6] = static_cast<uint8_t>(request.successfulStatusWords.size() >> 8);
+            out[entry + 7] = static_cast<uint8_t>(request.successfulStatusWords.size());
+            append(out, request.apdu);
+            for (const uint16_t statusWord : request.successfulStatusWords) {
+                putU16(out, statusWord);
+            }
+        }
+        setU32(out, record, static_cast<uint32_t>(out.size() - record));
+    }
+
+    setU32(out, 16, static_cast<uint32_t>(out.size()));
+    return out;
+}
+
+std::string toHex(const std::vector<uint8_t>& bytes)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    std::string hex;
+    for (const uint8_t b : bytes) {
+        hex += digits[b >> 4];
+        hex += digits[b & 0x0F];
+    }
+    return hex;
+}
+
+std::string encodeJson(const std::vector<Case>& cases)
+{
+    std::string json = "{\"multipleSelectionMode\":false,\"channelControl\":\"KEEP_OPEN\","
+                       "\"selectionOrder\":\"FIXED\",\"lazyResultParsing\":false,"
+                       "\"timingReportEnabled\":false,\"timeBudgetMicros\":0,"
+                       "\"abortOnOverrun\":false,\"cardSelections\":[";
+    for (size_t i = 0; i < cases.size(); i++) {
+        const Case& c = cases[i];
+        json += i == 0 ? "{" : ",{";
+        json += "\"mutuallyExclusive\":";
+        json += c.mutuallyExclusive ? "true" : "false";
+        json += ",\"powerOnDataPrefilter\":{\"value\":\"" + toHex(c.prefilterValue) +
+                "\",\"mask\":\"" + toHex(c.prefilterMask) + "\"}";
+        json += ",\"cardProtocol\":\"" + c.cardProtocol + "\"";
+        json += ",\"cardSelectionClassName\":\"" + c.extensionType + "\"";
+        json += ",\"cardSelection\":\"" + toHex(c.extensionData) + "\"";
+        json += ",\"apduRequests\":[";
+        for (size_t j = 0; j < c.requests.size(); j++) {
+            json += j == 0 ? "{" : ",{";
+            json += "\"apdu\":\"" + toHex(c.requests[j].apdu) + "\",\"successfulStatusWords\":[";
+            for (size_t k = 0; k < c.requests[j].successfulStatusWords.size(); k++) {
+                char statusWord[8];
+                std::snprintf(statusWord,
+                              sizeof(statusWord),
+                              "%s\"%04X\"",
+                              k == 0 ? "" : ",",
+                              c.requests[j].successfulStatusWords[k]);
+                json += statusWord;
+            }
+            json += "]}";
+        }
+        json += "]}";
+    }
+    json += "]}";
+    return json;
+}
+
+/**
+ * Checks the structure of version 1 data and sums the pre-encoded APDU bytes read in place.
+ *
+ * @return The sum of the APDU bytes, -1 if the data is malformed.
+ */
+long openInPlace(const uint8_t* data, const size_t length)
+{
+    if (length < CardSelectionScenarioBinaryFormat_CASE_TABLE_OFFSET ||
+        getU32(data, 16) != length) {
+        return -1;
+    }
+    for (size_t i = 0; i < CardSelectionScenarioBinaryFormat_MAGIC_LENGTH; i++) {
+        if (data[i] != CardSelectionScenarioBinaryFormat_MAGIC[i]) {
+            return -1;
+        }
+    }
+    if (getU16(data, 4) != CardSelectionScenarioBinaryFormat_VERSION) {
+        return -1;
+    }
+
+    long sum = 0;
+    const size_t caseCount = getU16(data, 14);
+    if (caseCount == 0 ||
+        CardSelectionScenarioBinaryFormat_CASE_TABLE_OFFSET + 4 * caseCount > length) {
+        return -1;
+    }
+    for (size_t i = 0; i < caseCount; i++) {
+        const size_t record =
+            getU32(data, CardSelectionScenarioBinaryFormat_CASE_TABLE_OFFSET + 4 * i);
+        if (record % CardSelectionScenarioBinaryFormat_ALIGNMENT != 0 ||
+            record + CardSelectionScenarioBinaryFormat_CASE_HEADER_LENGTH > length) {
+            return -1;
+        }
+        const size_t recordEnd = record + getU32(data, record);
+        const size_t requestCount = getU16(data, record + 6);
+        const size_t requestTable = record + CardSelectionScenarioBinaryFormat_CASE_HEADER_LENGTH;
+        if (recordEnd > length ||
+            requestTable + CardSelectionScenarioBinaryFormat_REQUEST_ENTRY_LENGTH * requestCount >
+                recordEnd) {
+            return -1;
+        }
+        for (size_t j = 0; j < requestCount; j++) {
+            const size_t entry =
+                requestTable + CardSelectionScenarioBinaryFormat_REQUEST_ENTRY_LENGTH * j;
+            const size_t apdu = getU32(data, entry);
+            const size_t apduLength = getU16(data, entry + 4);
+            const size_t statusWordCount = getU16(data, entry + 6);
+            if (apdu + apduLength + 2 * statusWordCount > recordEnd) {
+                return -1;
+            }
+            for (size_t k = 0; k < apduLength; k++) {
+                sum += data[apdu + k];
+            }
+        }
+    }
+    return sum;
+}
+
+std::vector<uint8_t> selectApplication(const std::vector<uint8_t>& aid)
+{
+    std::vector<uint8_t> apdu = {0x00, 0xA4, 0x04, 0x00, static_cast<uint8_t>(aid.size())};
+    apdu.insert(apdu.end(), aid.begin(), aid.end());
+    apdu.push_back(0x00);
+    return apdu;
+}
+
+/**
+ * Typical case: one Select Application command, possibly followed by a Read Record command.
+ */
+Case createCase(const int index, const bool withReadRecord)
+{
+    const std::vector<uint8_t> aid = {
+        0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01, static_cast<uint8_t>(index)};
+    Case c;
+    c.mutuallyExclusive = true;
+    c.prefilterValue = {0x3B, 0x8F, 0x80, 0x01};
+    c.prefilterMask = {0xFF, 0xFF, 0xFF, 0xFF};
+    c.cardProtocol = "ISO_14443_4";
+    c.extensionType = "org.calypsonet.terminal.calypso.card.CalypsoCardSelection";
+    c.extensionData = std::vector<uint8_t>(16, static_cast<uint8_t>(index));
+    c.requests.push_back({selectApplication(aid), {0x9000, 0x6283}});
+    if (withReadRecord) {
+        c.requests.push_back({{0x00, 0xB2, 0x01, 0x3C, 0x00}, {0x9000}});
+    }
+    return c;
+}
+
+long sumApdus(const std::vector<Case>& cases)
+{
+    long sum = 0;
+    for (const Case& c : cases) {
+        for (const Request& request : c.requests) {
+            for (const uint8_t b : request.apdu) {
+                sum += b;
+            }
+        }
+    }
+    return sum;
+}
+
+}
+
+int main()
+{
+    const int caseCounts[] = {1, 3, 8};
+
+    for (const int caseCount : caseCounts) {
+        std::vector<Case> cases;
+        for (int i = 0; i < caseCount; i++) {
+            cases.push_back(createCase(i, i % 2 == 0));
+        }
+        const std::vector<uint8_t> binary = encodeBinary(cases);
+        const std::string json = encodeJson(cases);
+
+        volatile long checksum = 0;
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < OPEN_COUNT; i++) {
+            checksum = checksum + openInPlace(binary.data(), binary.size());
+        }
+        const double nanoseconds =
+            std::chrono::duration<double, std::nano>(Clock::now() - start).count() / OPEN_COUNT;
+
+        if (openInPlace(binary.data(), binary.size()) != sumApdus(cases)) {
+            std::printf("in-place reading mismatch\n");
+            return EXIT_FAILURE;
+        }
+        std::printf("cases=%d  binary bytes=%5zu  json bytes=%5zu  ratio=%4.2f  "
+                    "in-place check ns=%6.1f  (checksum %ld)\n",
+                    caseCount,
+                    binary.size(),
+                    json.size(),
+                    static_cast<double>(binary.size()) / json.size(),
+                    nanoseconds,
+                    static_cast<long>(checksum));
+    }
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ConfigurableCardReader.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+TEST(ConfigurableCardReaderTest, protocolMaskOf_shouldSetSingleBit)
+{
+    static_assert(ConfigurableCardReader::protocolMaskOf(0) == 1u, "constant expression");
+
+    ASSERT_EQ(ConfigurableCardReader::protocolMaskOf(63), 0x8000000000000000u);
+}
+
+TEST(ConfigurableCardReaderTest, protocolMaskOf_whenIdIsOutOfRange_shouldThrowIAE)
+{
+    EXPECT_THROW(ConfigurableCardReader::protocolMaskOf(-1), IllegalArgumentException);
+    EXPECT_THROW(ConfigurableCardReader::protocolMaskOf(ConfigurableCardReader::MAX_PROTOCOL_COUNT),
+                 IllegalArgumentException);
+}
@@ -0,0 +1,70 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "InlineByteBuffer.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+TEST(InlineByteBufferTest, defaultConstructor_shouldBeEmptyAndInline)
+{
+    const InlineByteBuffer<> buffer;
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE(buffer.isInline());
+    ASSERT_TRUE(buffer.view().empty());
+}
+
+TEST(InlineByteBufferTest, assign_whenSizeFitsInline_shouldStoreInline)
+{
+    const std::vector<uint8_t> bytes = {0x6F, 0x0A, 0x90, 0x00};
+    const InlineByteBuffer<4> buffer(bytes);
+
+    ASSERT_TRUE(buffer.isInline());
+    ASSERT_NE(buffer.data(), bytes.data());
+    ASSERT_THAT(buffer.view().toVector(), ElementsAre(0x6F, 0x0A, 0x90, 0x00));
+}
+
+TEST(InlineByteBufferTest, assign_whenSizeExceedsInlineCapacity_shouldStoreOnHeap)
+{
+    const std::vector<uint8_t> bytes = {0x6F, 0x0A, 0x90, 0x00, 0x01};
+    InlineByteBuffer<4> buffer(bytes);
+
+    ASSERT_FALSE(buffer.isInline());
+    ASSERT_EQ(buffer.view().toVector(), bytes);
+
+    buffer.assign(bytes.data(), 2);
+
+    ASSERT_TRUE(buffer.isInline());
+    ASSERT_THAT(buffer.view().toVector(), ElementsAre(0x6F, 0x0A));
+}
+
+TEST(InlineByteBufferTest, copy_shouldCopyBytesIntoOwnStorage)
+{
+    const std::vector<uint8_t> small = {0x90, 0x00};
+    const std::vector<uint8_t> large(100, 0xAB);
+    const InlineByteBuffer<> smallBuffer(small);
+    const InlineByteBuffer<> largeBuffer(large);
+
+    const InlineByteBuffer<> smallCopy(smallBuffer);
+    const InlineByteBuffer<> largeCopy(largeBuffer);
+
+    ASSERT_NE(smallCopy.data(), smallBuffer.data());
+    ASSERT_NE(largeCopy.data(), largeBuffer.data());
+    ASSERT_EQ(smallCopy.view().toVector(), small);
+    ASSERT_EQ(largeCopy.view().toVector(), large);
+}
@@ -0,0 +1,98 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ObjectPool.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+namespace {
+
+std::atomic<long> allocationCount(0);
+
+struct Event {
+    int type = 0;
+};
+
+}
+
+/* Counts the heap allocations of the whole test executable */
+void* operator new(std::size_t size)
+{
+    allocationCount++;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+TEST(ObjectPoolTest, constructor_whenCapacityIsNegative_shouldThrowIAE)
+{
+    EXPECT_THROW(ObjectPool<Event>(-1), IllegalArgumentException);
+}
+
+TEST(ObjectPoolTest, acquire_whenObjectIsReleased_shouldReuseIt)
+{
+    ObjectPool<Event> pool(1);
+
+    const Event* first = pool.acquire().get();
+
+    ASSERT_EQ(pool.acquire().get(), first);
+}
+
+TEST(ObjectPoolTest, acquire_whenAllObjectsAreReferenced_shouldAllocateNewOne)
+{
+    ObjectPool<Event> pool(1);
+    const std::shared_ptr<Event> kept = pool.acquire();
+
+    const std::shared_ptr<Event> other = pool.acquire();
+
+    ASSERT_NE(other, nullptr);
+    ASSERT_NE(other, kept);
+}
+
+TEST(ObjectPoolTest, acquire_inSteadyState_shouldNotAllocate)
+{
+    ObjectPool<Event> pool(4);
+    std::shared_ptr<Event> observed[2];
+
+    const long before = allocationCount;
+    for (int tap = 0; tap < 1000; tap++) {
+        /* An event handed to an observer keeping it until the next tap */
+        std::shared_ptr<Event> event = pool.acquire();
+        event->type = tap % 2;
+        observed[tap % 2] = event;
+    }
+
+    ASSERT_EQ(allocationCount - before, 0);
+}
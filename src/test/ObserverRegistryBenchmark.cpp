@@ -0,0 +1,245 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+/*
+ * Contention benchmark of the observer registry: notifier threads dispatch events to the
+ * observers while a registration thread keeps adding and removing observers. The copy-on-write
+ * ObserverRegistry is compared with a list protected by a mutex held during the dispatch.
+ *
+ * Each observer simulates a short processing. Each registration change simulates a slow change
+ * (e.g. the creation of the delivery queue of the observer) performed while holding the lock
+ * serializing the changes: with the mutex-protected list, it is the lock of the list, so the
+ * notifications wait behind it; with the copy-on-write registry, the notifications never take
+ * it. The number of notifications blocked on a lock (behind a change or another notification)
+ * and the latency percentiles of the notifications show the difference; the throughput mostly
+ * reflects the cost of taking a snapshot. The latencies are only meaningful with at least one
+ * core per thread: otherwise they are dominated by the scheduling of the busy threads.
+ *
+ * Usage: keypleterminalreader_bench [max notifier count]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Calypsonet Terminal Reader */
+#include "ObserverRegistry.h"
+
+using namespace calypsonet::terminal::reader;
+
+namespace {
+
+const int OBSERVER_COUNT = 8;
+const std::chrono::milliseconds DURATION(1000);
+const std::chrono::microseconds REGISTRATION_PERIOD(200);
+const std::chrono::microseconds REGISTRATION_CHANGE_DURATION(20);
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Simulates the processing of an event by an observer (a few hundred nanoseconds).
+ */
+long processEvent(const int observer)
+{
+    volatile long result = observer;
+    for (int i = 0; i < 200; i++) {
+        result = result + i;
+    }
+    return result;
+}
+
+/**
+ * Simulates the slow part of a registration change (busy wait, to keep the lock held).
+ */
+void processRegistrationChange()
+{
+    const Clock::time_point end = Clock::now() + REGISTRATION_CHANGE_DURATION;
+    while (Clock::now() < end) {
+    }
+}
+
+/**
+ * Baseline: a mutex held during the registration changes and the notifications.
+ */
+class LockedRegistry {
+public:
+    void add(const std::shared_ptr<int>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        processRegistrationChange();
+        mObservers.push_back(observer);
+    }
+
+    void remove(const std::shared_ptr<int>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        processRegistrationChange();
+        for (auto it = mObservers.begin(); it != mObservers.end(); ++it) {
+            if (*it == observer) {
+                mObservers.erase(it);
+                break;
+            }
+        }
+    }
+
+    long notify()
+    {
+        std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            mBlockedNotifications++;
+            lock.lock();
+        }
+        long sum = 0;
+        for (const auto& observer : mObservers) {
+            sum += processEvent(*observer);
+        }
+        return sum;
+    }
+
+    long getBlockedNotificationCount() const
+    {
+        return mBlockedNotifications;
+    }
+
+private:
+    std::mutex mMutex;
+    std::vector<std::shared_ptr<int>> mObservers;
+    std::atomic<long> mBlockedNotifications{0};
+};
+
+/**
+ * Copy-on-write registry, notifications iterating over a snapshot. The changes are serialized by
+ * a mutex never taken by the notifications.
+ */
+class CopyOnWriteRegistry {
+public:
+    void add(const std::shared_ptr<int>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mChangeMutex);
+        processRegistrationChange();
+        mRegistry.add(observer);
+    }
+
+    void remove(const std::shared_ptr<int>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mChangeMutex);
+        processRegistrationChange();
+        mRegistry.remove(observer);
+    }
+
+    long notify()
+    {
+        const auto snapshot = mRegistry.getSnapshot();
+        long sum = 0;
+        for (const auto& entry : *snapshot) {
+            sum += processEvent(*entry.getObserver());
+        }
+        return sum;
+    }
+
+    long getBlockedNotificationCount() const
+    {
+        /* The notifications take no lock */
+        return 0;
+    }
+
+private:
+    std::mutex mChangeMutex;
+    ObserverRegistry<int> mRegistry;
+};
+
+template <typename Registry>
+void run(const char* name, const int notifierCount)
+{
+    Registry registry;
+    for (int i = 0; i < OBSERVER_COUNT; i++) {
+        registry.add(std::make_shared<int>(i));
+    }
+
+    std::atomic<bool> running(true);
+    std::atomic<long> changes(0);
+    std::atomic<long> checksum(0);
+    std::mutex latenciesMutex;
+    std::vector<long> latencies;
+
+    std::vector<std::thread> notifiers;
+    for (int i = 0; i < notifierCount; i++) {
+        notifiers.emplace_back([&]() {
+            std::vector<long> localLatencies;
+            long sum = 0;
+            while (running) {
+                const Clock::time_point start = Clock::now();
+                sum += registry.notify();
+                localLatencies.push_back(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+                        .count());
+            }
+            checksum += sum;
+            std::lock_guard<std::mutex> lock(latenciesMutex);
+            latencies.insert(latencies.end(), localLatencies.begin(), localLatencies.end());
+        });
+    }
+
+    std::thread registrar([&]() {
+        long count = 0;
+        while (running) {
+            auto observer = std::make_shared<int>(1);
+            registry.add(observer);
+            registry.remove(observer);
+            count += 2;
+            std::this_thread::sleep_for(REGISTRATION_PERIOD);
+        }
+        changes += count;
+    });
+
+    std::this_thread::sleep_for(DURATION);
+    running = false;
+    for (auto& notifier : notifiers) {
+        notifier.join();
+    }
+    registrar.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    const double seconds = std::chrono::duration<double>(DURATION).count();
+    std::printf("%-14s notifiers=%d  notifications/s=%10.0f  changes/s=%7.0f  "
+                "blocked=%7ld  latency ns p50=%6ld p99=%7ld p99.9=%8ld max=%9ld  (checksum %ld)\n",
+                name,
+                notifierCount,
+                latencies.size() / seconds,
+                changes / seconds,
+                registry.getBlockedNotificationCount(),
+                latencies[latencies.size() / 2],
+                latencies[latencies.size() * 99 / 100],
+                latencies[latencies.size() * 999 / 1000],
+                latencies.back(),
+                checksum.load());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const int maxNotifiers = argc > 1 ? std::atoi(argv[1]) : 4;
+
+    for (int notifierCount = 1; notifierCount <= maxNotifiers; notifierCount *= 2) {
+        run<LockedRegistry>("mutex", notifierCount);
+        run<CopyOnWriteRegistry>("copy-on-write", notifierCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ObserverRegistry.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+
+namespace {
+
+std::vector<std::shared_ptr<int>> observersOf(const ObserverRegistry<int>::Entries& entries)
+{
+    std::vector<std::shared_ptr<int>> observers;
+    for (const auto& entry : entries) {
+        observers.push_back(entry.getObserver());
+    }
+    return observers;
+}
+
+}
+
+TEST(ObserverRegistryTest, atomics_shouldBeLockFree)
+{
+    const std::atomic<const std::shared_ptr<int>*> pointer(nullptr);
+    const std::atomic<unsigned int> counter(0);
+
+    ASSERT_TRUE(pointer.is_lock_free());
+    ASSERT_TRUE(counter.is_lock_free());
+}
+
+TEST(ObserverRegistryTest, add_whenObserverIsNull_shouldThrowIAE)
+{
+    ObserverRegistry<int> registry;
+
+    EXPECT_THROW(registry.add(nullptr), IllegalArgumentException);
+}
+
+TEST(ObserverRegistryTest, add_shouldKeepRegistrationOrderAndIgnoreDuplicates)
+{
+    ObserverRegistry<int> registry;
+    auto observer1 = std::make_shared<int>(1);
+    auto observer2 = std::make_shared<int>(2);
+
+    ASSERT_TRUE(registry.add(observer1));
+    ASSERT_TRUE(registry.add(observer2));
+    ASSERT_FALSE(registry.add(observer1));
+
+    ASSERT_EQ(registry.count(), 2);
+    ASSERT_THAT(observersOf(*registry.getSnapshot()), ElementsAre(observer1, observer2));
+}
+
+TEST(ObserverRegistryTest, add_whenObserverIsRegistered_shouldReplaceAttributesInPlace)
+{
+    ObserverRegistry<int, unsigned int> registry;
+    auto observer1 = std::make_shared<int>(1);
+    auto observer2 = std::make_shared<int>(2);
+    registry.add(observer1, 0x01);
+    registry.add(observer2, 0x02);
+
+    ASSERT_FALSE(registry.add(observer1, 0x04));
+
+    const auto snapshot = registry.getSnapshot();
+    ASSERT_EQ(snapshot->size(), 2u);
+    ASSERT_EQ((*snapshot)[0].getObserver(), observer1);
+    ASSERT_EQ((*snapshot)[0].getAttributes(), 0x04u);
+    ASSERT_EQ((*snapshot)[1].getAttributes(), 0x02u);
+}
+
+TEST(ObserverRegistryTest, remove_whenObserverIsNull_shouldThrowIAE)
+{
+    ObserverRegistry<int> registry;
+
+    EXPECT_THROW(registry.remove(nullptr), IllegalArgumentException);
+}
+
+TEST(ObserverRegistryTest, remove_shouldRemoveOnlyRegisteredObserver)
+{
+    ObserverRegistry<int> registry;
+    auto observer1 = std::make_shared<int>(1);
+    auto observer2 = std::make_shared<int>(2);
+    auto observer3 = std::make_shared<int>(3);
+    registry.add(observer1);
+    registry.add(observer2);
+    registry.add(observer3);
+
+    ASSERT_TRUE(registry.remove(observer2));
+    ASSERT_FALSE(registry.remove(observer2));
+
+    ASSERT_THAT(observersOf(*registry.getSnapshot()), ElementsAre(observer1, observer3));
+}
+
+TEST(ObserverRegistryTest, clear_shouldRemoveAllObservers)
+{
+    ObserverRegistry<int> registry;
+    registry.add(std::make_shared<int>(1));
+    registry.add(std::make_shared<int>(2));
+
+    registry.clear();
+
+    ASSERT_EQ(registry.count(), 0);
+    ASSERT_TRUE(registry.getSnapshot()->empty());
+}
+
+TEST(ObserverRegistryTest, getSnapshot_shouldNotBeAffectedByLaterChanges)
+{
+    ObserverRegistry<int> registry;
+    auto observer1 = std::make_shared<int>(1);
+    registry.add(observer1);
+
+    const auto snapshot = registry.getSnapshot();
+    registry.add(std::make_shared<int>(2));
+    registry.remove(observer1);
+
+    ASSERT_THAT(observersOf(*snapshot), ElementsAre(observer1));
+    ASSERT_EQ(registry.count(), 1);
+}
+
+TEST(ObserverRegistryTest, concurrentChangesAndNotifications_shouldKeepConsistentSnapshots)
+{
+    ObserverRegistry<int> registry;
+    auto permanent = std::make_shared<int>(0);
+    registry.add(permanent);
+
+    std::atomic<bool> running(true);
+    std::atomic<bool> consistent(true);
+
+    std::thread notifier([&]() {
+        while (running) {
+            const auto snapshot = registry.getSnapshot();
+            if (snapshot->empty() || snapshot->front().getObserver() != permanent) {
+                consistent = false;
+            }
+        }
+    });
+
+    for (int i = 0; i < 10000; i++) {
+        auto transient = std::make_shared<int>(i);
+        registry.add(transient);
+        registry.remove(transient);
+    }
+
+    running = false;
+    notifier.join();
+
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(registry.count(), 1);
+}
@@ -0,0 +1,171 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ReaderResult.h"
+#include "ReaderResultExceptions.h"
+#include "SelectionResultExceptions.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::selection;
+
+class CardSelectionTimingReportMock final : public CardSelectionTimingReport {
+public:
+    MOCK_METHOD(std::chrono::microseconds, getTotalDuration, (), (const, override));
+    MOCK_METHOD(std::chrono::microseconds, getChannelOpeningDuration, (), (const, override));
+    MOCK_METHOD(std::chrono::microseconds, getChannelClosingDuration, (), (const, override));
+    MOCK_METHOD(std::chrono::microseconds, getSelectionDuration, (const int), (const, override));
+    MOCK_METHOD(std::chrono::microseconds, getCommandsDuration, (const int), (const, override));
+    MOCK_METHOD(bool, isBudgetExceeded, (), (const, override));
+};
+
+class CardSelectionResultMock final : public CardSelectionResult {
+public:
+    MOCK_METHOD((const std::map<int, std::shared_ptr<SmartCard>>&),
+                getSmartCards,
+                (),
+                (const, override));
+    MOCK_METHOD(const std::vector<std::shared_ptr<SmartCard>>&,
+                getIndexedSmartCards,
+                (),
+                (const, override));
+    MOCK_METHOD(const std::shared_ptr<SmartCard>, getActiveSmartCard, (), (const, override));
+    MOCK_METHOD(int, getActiveSelectionIndex, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<CardSelectionTimingReport>,
+                getTimingReport,
+                (),
+                (const, override));
+};
+
+TEST(ReaderResultTest, success_shouldHoldValueAndOkCode)
+{
+    const ReaderResult<bool> result = ReaderResult<bool>::success(true);
+
+    ASSERT_TRUE(result.isSuccess());
+    ASSERT_EQ(result.getErrorCode(), ReaderErrorCode::OK);
+    ASSERT_TRUE(result.getValue());
+    ASSERT_TRUE(getValueOrThrow(result, "context"));
+}
+
+TEST(ReaderResultTest, failure_shouldHoldErrorCodeAndDefaultValue)
+{
+    const ReaderResult<std::shared_ptr<int>> result =
+        ReaderResult<std::shared_ptr<int>>::failure(ReaderErrorCode::CARD_COMMUNICATION_FAILURE);
+
+    ASSERT_FALSE(result.isSuccess());
+    ASSERT_EQ(result.getErrorCode(), ReaderErrorCode::CARD_COMMUNICATION_FAILURE);
+    ASSERT_EQ(result.getValue(), nullptr);
+}
+
+TEST(ReaderResultTest, getValueOrThrow_whenInvalidArgument_shouldThrowIAE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::INVALID_ARGUMENT);
+
+    EXPECT_THROW(getValueOrThrow(result, "context"), IllegalArgumentException);
+}
+
+TEST(ReaderResultTest, getValueOrThrow_whenReaderFailure_shouldThrowRCE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::READER_COMMUNICATION_FAILURE);
+
+    EXPECT_THROW(getValueOrThrow(result, "context"), ReaderCommunicationException);
+}
+
+TEST(ReaderResultTest, getValueOrThrow_whenCardFailure_shouldThrowCCE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::CARD_COMMUNICATION_FAILURE);
+
+    EXPECT_THROW(getValueOrThrow(result, "context"), CardCommunicationException);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenInvalidResponse_shouldThrowICRE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::INVALID_CARD_RESPONSE);
+
+    EXPECT_THROW(getSelectionValueOrThrow(result, "context"), InvalidCardResponseException);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenDeadlineExceeded_shouldThrowCSAE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::DEADLINE_EXCEEDED);
+
+    EXPECT_THROW(getSelectionValueOrThrow(result, "context"), CardSelectionAbortedException);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenCancelled_shouldThrowCSAE)
+{
+    const ReaderResult<bool> result = ReaderResult<bool>::failure(ReaderErrorCode::CANCELLED);
+
+    EXPECT_THROW(getSelectionValueOrThrow(result, "context"), CardSelectionAbortedException);
+}
+
+TEST(ReaderResultTest, getValueOrThrow_whenSelectionErrorCode_shouldThrowISE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::INVALID_CARD_RESPONSE);
+
+    EXPECT_THROW(getValueOrThrow(result, "context"), IllegalStateException);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenReaderFailure_shouldThrowRCE)
+{
+    const ReaderResult<bool> result =
+        ReaderResult<bool>::failure(ReaderErrorCode::READER_COMMUNICATION_FAILURE);
+
+    EXPECT_THROW(getSelectionValueOrThrow(result, "context"), ReaderCommunicationException);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenResultIsTemporary_shouldReturnCopy)
+{
+    const std::shared_ptr<int> value = std::make_shared<int>(1);
+
+    const std::shared_ptr<int>& copy = getSelectionValueOrThrow(
+        ReaderResult<std::shared_ptr<int>>::success(value), "context");
+
+    ASSERT_EQ(copy, value);
+    ASSERT_EQ(value.use_count(), 2);
+}
+
+TEST(ReaderResultTest, failure_whenPartialValueIsProvided_shouldHoldIt)
+{
+    const ReaderResult<int> result = ReaderResult<int>::failure(ReaderErrorCode::CANCELLED, 3);
+
+    ASSERT_FALSE(result.isSuccess());
+    ASSERT_EQ(result.getValue(), 3);
+}
+
+TEST(ReaderResultTest, getSelectionValueOrThrow_whenDeadlineExceeded_shouldAttachTimingReport)
+{
+    auto timingReport = std::make_shared<CardSelectionTimingReportMock>();
+    auto partialResult = std::make_shared<CardSelectionResultMock>();
+    EXPECT_CALL(*partialResult, getTimingReport()).WillOnce(Return(timingReport));
+    const ReaderResult<std::shared_ptr<CardSelectionResult>> result =
+        ReaderResult<std::shared_ptr<CardSelectionResult>>::failure(
+            ReaderErrorCode::DEADLINE_EXCEEDED, partialResult);
+
+    try {
+        getSelectionValueOrThrow(result, "context");
+        FAIL();
+    } catch (const CardSelectionAbortedException& e) {
+        ASSERT_EQ(e.getTimingReport(), timingReport);
+    }
+}
@@ -0,0 +1,96 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "SmartCardsView.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::selection;
+
+class SmartCardMock final : public SmartCard {
+public:
+    MOCK_METHOD(const std::string&, getPowerOnData, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getSelectApplicationResponse, (), (const, override));
+    MOCK_METHOD(ByteView, getSelectApplicationResponseView, (), (const, override));
+};
+
+TEST(SmartCardsViewTest, iteration_whenListIsEmpty_shouldBeEmpty)
+{
+    const std::vector<std::shared_ptr<SmartCard>> smartCards;
+    const SmartCardsView view(smartCards);
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_TRUE(view.begin() == view.end());
+}
+
+TEST(SmartCardsViewTest, iteration_whenAllCasesFailed_shouldBeEmpty)
+{
+    const std::vector<std::shared_ptr<SmartCard>> smartCards(3);
+    const SmartCardsView view(smartCards);
+
+    ASSERT_TRUE(view.empty());
+}
+
+TEST(SmartCardsViewTest, iteration_shouldSkipUnsuccessfulCasesAndKeepIndexes)
+{
+    auto card1 = std::make_shared<SmartCardMock>();
+    auto card3 = std::make_shared<SmartCardMock>();
+    const std::vector<std::shared_ptr<SmartCard>> smartCards = {nullptr, card1, nullptr, card3};
+    const SmartCardsView view(smartCards);
+
+    std::vector<int> indexes;
+    std::vector<std::shared_ptr<SmartCard>> cards;
+    for (auto it = view.begin(); it != view.end(); ++it) {
+        indexes.push_back(it.getSelectionIndex());
+        cards.push_back(*it);
+    }
+
+    ASSERT_FALSE(view.empty());
+    ASSERT_THAT(indexes, ElementsAre(1, 3));
+    ASSERT_EQ(cards[0], card1);
+    ASSERT_EQ(cards[1], card3);
+}
+
+TEST(SmartCardsViewTest, iterator_whenDefaultConstructed_shouldBeEqualToAnotherDefaultOne)
+{
+    const SmartCardsView::Iterator it1;
+    const SmartCardsView::Iterator it2;
+
+    ASSERT_TRUE(it1 == it2);
+    ASSERT_FALSE(it1 != it2);
+}
+
+TEST(SmartCardsViewTest, iterator_whenViewsDiffer_shouldNotBeEqual)
+{
+    const std::vector<std::shared_ptr<SmartCard>> smartCards1(2);
+    const std::vector<std::shared_ptr<SmartCard>> smartCards2(2);
+    const SmartCardsView view1(smartCards1);
+    const SmartCardsView view2(smartCards2);
+
+    ASSERT_TRUE(view1.end() != view2.end());
+    ASSERT_TRUE(view1.end() == SmartCardsView(smartCards1).end());
+}
+
+TEST(SmartCardsViewTest, constructor_whenListIsTemporary_shouldNotCompile)
+{
+    typedef std::vector<std::shared_ptr<SmartCard>> SmartCards;
+
+    ASSERT_TRUE((std::is_constructible<SmartCardsView, const SmartCards&>::value));
+    ASSERT_FALSE((std::is_constructible<SmartCardsView, SmartCards>::value));
+}